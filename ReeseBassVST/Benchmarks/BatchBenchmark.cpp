@@ -0,0 +1,92 @@
+#include "BenchmarkUtils.h"
+#include "PluginProcessor.h"
+#include "DSP/BatchedReeseEngine.h"
+
+/**
+ * BatchBenchmark - Many stems: one processor per stereo stem vs BatchedReeseEngine
+ *
+ * Renders K mono chains (K/2 stereo stems) of noise at 48kHz, 512-sample
+ * blocks, through K/2 plugin instances one after another, and through one
+ * BatchedReeseEngine with K lanes. Results are seconds of stem audio
+ * rendered per second of CPU time, summed over the stems.
+ */
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+    constexpr double secondsPerCase = 2.0;
+    constexpr int numBlocks = static_cast<int>(secondsPerCase * sampleRate / blockSize);
+
+    const int chainCounts[] = { 8, 32, 128 };
+
+    double measureProcessors(int numChains)
+    {
+        // Full band, soft knee, no modulation: what the engine models
+        std::vector<std::unique_ptr<ReeseDestroyerAudioProcessor>> processors;
+
+        for (int i = 0; i < numChains / 2; ++i)
+        {
+            auto processor = std::make_unique<ReeseDestroyerAudioProcessor>();
+            processor->setPlayConfigDetails(2, 2, sampleRate, blockSize);
+            processor->prepareToPlay(sampleRate, blockSize);
+            processors.push_back(std::move(processor));
+        }
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midi;
+        juce::Random random(1);
+
+        const double microseconds = BenchmarkUtils::measureMicroseconds(numBlocks, [&](int) {
+            for (auto& processor : processors)
+            {
+                for (int channel = 0; channel < 2; ++channel)
+                    for (int sample = 0; sample < blockSize; ++sample)
+                        buffer.setSample(channel, sample, random.nextFloat() * 0.5f - 0.25f);
+
+                processor->processBlock(buffer, midi);
+            }
+        });
+
+        return numChains / 2 * (blockSize / sampleRate) / (microseconds * 1.0e-6);
+    }
+
+    double measureEngine(int numChains)
+    {
+        BatchedReeseEngine engine;
+        engine.prepare(sampleRate, numChains);
+
+        std::vector<std::vector<float>> buffers(static_cast<size_t>(numChains), std::vector<float>(blockSize));
+        std::vector<float*> channels;
+        for (auto& buffer : buffers)
+            channels.push_back(buffer.data());
+
+        juce::Random random(1);
+
+        const double microseconds = BenchmarkUtils::measureMicroseconds(numBlocks, [&](int) {
+            for (auto& buffer : buffers)
+                for (auto& sample : buffer)
+                    sample = random.nextFloat() * 0.5f - 0.25f;
+
+            engine.process(channels.data(), channels.data(), blockSize);
+        });
+
+        return numChains / 2 * (blockSize / sampleRate) / (microseconds * 1.0e-6);
+    }
+}
+
+void runBatchBenchmark()
+{
+    BenchmarkUtils::printHeader("Many stems: processors vs batched engine (stereo stems x realtime)");
+    std::printf("  %d lanes per vector\n", BatchedReeseEngine::lanesPerVector);
+
+    for (const int numChains : chainCounts)
+    {
+        const auto processors = measureProcessors(numChains);
+        const auto engine = measureEngine(numChains);
+        const auto label = juce::String(numChains / 2) + " stereo stems";
+
+        BenchmarkUtils::printResult((label + "  processors").toRawUTF8(), processors, "x");
+        BenchmarkUtils::printResult((label + "  batched").toRawUTF8(), engine, "x");
+        BenchmarkUtils::printResult((label + "  speedup").toRawUTF8(), engine / processors, "x");
+    }
+}
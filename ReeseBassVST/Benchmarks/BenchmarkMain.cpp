@@ -0,0 +1,89 @@
+#include <juce_events/juce_events.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "Profiling/StageTrace.h"
+#include "Threading/AudioThreadGuard.h"
+
+/**
+ * ReeseBenchmarks - Developer benchmark runner
+ *
+ * Usage: ReeseBenchmarks [suite ...] [--trace FILE]
+ * With no suite names every suite runs. Build with -DREESE_BUILD_BENCHMARKS=ON.
+ * With -DREESE_AUDIO_THREAD_GUARD=ON, audio-thread allocations/locks are
+ * reported and make the run exit nonzero. With -DREESE_STAGE_TRACE=ON,
+ * --trace writes per-stage timings as Chrome trace JSON.
+ */
+
+void runStateBenchmark();
+void runParallelBenchmark();
+void runBatchBenchmark();
+void runInstantiationBenchmark();
+void runBlockSizeBenchmark();
+void runFilterBenchmark();
+void runCabinetBenchmark();
+
+namespace
+{
+    struct BenchmarkSuite
+    {
+        const char* name;
+        void (*run)();
+    };
+
+    const BenchmarkSuite suites[] = {
+        { "state", runStateBenchmark },
+        { "parallel", runParallelBenchmark },
+        { "batch", runBatchBenchmark },
+        { "instantiation", runInstantiationBenchmark },
+        { "blocksize", runBlockSizeBenchmark },
+        { "filters", runFilterBenchmark },
+        { "cabinet", runCabinetBenchmark },
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    // Processors and APVTS expect the message manager to exist
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    std::vector<const char*> selectedNames;
+    juce::File traceFile;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+            traceFile = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else
+            selectedNames.push_back(argv[i]);
+    }
+
+    for (const auto& suite : suites)
+    {
+        bool selected = selectedNames.empty();
+
+        for (const auto* name : selectedNames)
+            selected = selected || std::strcmp(name, suite.name) == 0;
+
+        if (selected)
+            suite.run();
+    }
+
+    if (traceFile != juce::File())
+    {
+        if (!StageTrace::isEnabled())
+            std::printf("\n--trace ignored: configure with -DREESE_STAGE_TRACE=ON\n");
+        else if (StageTrace::writeChromeTrace(traceFile))
+            std::printf("\nStage trace written to %s\n", traceFile.getFullPathName().toRawUTF8());
+        else
+            std::printf("\nCould not write %s\n", traceFile.getFullPathName().toRawUTF8());
+    }
+
+    if (AudioThreadGuard::isEnabled())
+    {
+        std::printf("\nAudio thread: %d allocation/lock calls\n", AudioThreadGuard::getNumViolations());
+        return AudioThreadGuard::getNumViolations() == 0 ? 0 : 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <chrono>
+#include <cstdio>
+
+/**
+ * BenchmarkUtils - Minimal timing helpers shared by the benchmark suites
+ *
+ * Suites time a callable over many iterations and print one line per case,
+ * so results can be diffed between builds.
+ */
+namespace BenchmarkUtils
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Run fn() `iterations` times and return the mean time per call in microseconds
+     */
+    template <typename Fn>
+    double measureMicroseconds(int iterations, Fn&& fn)
+    {
+        const auto start = Clock::now();
+
+        for (int i = 0; i < iterations; ++i)
+            fn(i);
+
+        const auto elapsed = std::chrono::duration<double, std::micro>(Clock::now() - start);
+        return elapsed.count() / static_cast<double>(juce::jmax(1, iterations));
+    }
+
+    inline void printHeader(const char* suiteName)
+    {
+        std::printf("\n== %s ==\n", suiteName);
+    }
+
+    inline void printResult(const char* caseName, double microseconds, const char* unit = "us")
+    {
+        std::printf("  %-44s %12.3f %s\n", caseName, microseconds, unit);
+    }
+}
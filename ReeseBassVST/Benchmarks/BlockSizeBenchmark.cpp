@@ -0,0 +1,67 @@
+#include "BenchmarkUtils.h"
+#include "PluginProcessor.h"
+
+/**
+ * BlockSizeBenchmark - Cost per sample across host block sizes
+ *
+ * Hosts call processBlock with anything from a single sample to several
+ * thousand, and the size may change from call to call. One instance is
+ * prepared for the largest size, then fed a second of audio at each host
+ * block size. Small blocks show the per-call overhead, large ones whether
+ * the internal chunks keep the working set in cache.
+ */
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int maxBlockSize = 8192;
+    constexpr int hostBlockSizes[] = { 1, 7, 32, 64, 100, 512, 4096, 8192 };
+
+    double measurePerSample(int hostBlockSize)
+    {
+        ReeseDestroyerAudioProcessor processor;
+
+        // Multiband with both band chains active: the heaviest channel pass
+        auto& parameters = processor.getParameters();
+        for (const auto* id : { "multiband", "subCharacter", "highCharacter" })
+            parameters.getParameter(id)->setValueNotifyingHost(1.0f);
+
+        processor.setPlayConfigDetails(2, 2, sampleRate, maxBlockSize);
+        processor.prepareToPlay(sampleRate, maxBlockSize);
+
+        juce::AudioBuffer<float> input(2, maxBlockSize);
+        juce::AudioBuffer<float> buffer(2, hostBlockSize);
+        juce::MidiBuffer midi;
+        juce::Random random(1);
+
+        for (int channel = 0; channel < 2; ++channel)
+            for (int sample = 0; sample < maxBlockSize; ++sample)
+                input.setSample(channel, sample, random.nextFloat() * 0.5f - 0.25f);
+
+        const int numBlocks = juce::jmax(1, static_cast<int>(sampleRate) / hostBlockSize);
+        int position = 0;
+
+        const auto perBlock = BenchmarkUtils::measureMicroseconds(numBlocks, [&](int) {
+            if (position + hostBlockSize > maxBlockSize)
+                position = 0;
+
+            for (int channel = 0; channel < 2; ++channel)
+                buffer.copyFrom(channel, 0, input, channel, position, hostBlockSize);
+
+            position += hostBlockSize;
+            processor.processBlock(buffer, midi);
+        });
+
+        return perBlock * 1000.0 / hostBlockSize;
+    }
+}
+
+void runBlockSizeBenchmark()
+{
+    BenchmarkUtils::printHeader("Host block size (per sample, stereo, prepared for 8192)");
+
+    for (const int hostBlockSize : hostBlockSizes)
+    {
+        const auto label = juce::String(hostBlockSize) + (hostBlockSize == 1 ? " sample" : " samples");
+        BenchmarkUtils::printResult(label.toRawUTF8(), measurePerSample(hostBlockSize), "ns");
+    }
+}
@@ -0,0 +1,125 @@
+#include "BenchmarkUtils.h"
+#include "DSP/PartitionedConvolver.h"
+#include <vector>
+
+/**
+ * CabinetBenchmark - Partitioned convolution cost, build time and memory
+ *
+ * Per-sample cost of one PartitionedConvolver channel for short, medium and
+ * maximum-length (250ms) IRs, at host blocks of 64 and 512 samples (the
+ * convolver runs on its own 64-sample grid, so the two should match), next
+ * to a direct-form convolution of the same IR. Then the time to conform and
+ * transform an IR recorded at 44.1kHz for a 48kHz session, and the memory
+ * of a project with the same cabinet on 300 tracks: the spectra are shared,
+ * only the frequency-domain delay lines are per instance.
+ */
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int numInstances = 300;
+
+    std::vector<float> makeImpulse(int length)
+    {
+        juce::Random random(length);
+        std::vector<float> ir(static_cast<size_t>(length));
+
+        for (int t = 0; t < length; ++t)
+            ir[static_cast<size_t>(t)] = (random.nextFloat() * 2.0f - 1.0f) * std::exp(-5.0f * static_cast<float>(t) / static_cast<float>(length));
+
+        return ir;
+    }
+
+    std::vector<float> makeNoise(int length)
+    {
+        juce::Random random(0x5eed);
+        std::vector<float> noise(static_cast<size_t>(length));
+
+        for (auto& sample : noise)
+            sample = 0.25f * (random.nextFloat() * 2.0f - 1.0f);
+
+        return noise;
+    }
+
+    double measureConvolver(const std::shared_ptr<const CabinetImpulse>& impulse, int blockSize)
+    {
+        PartitionedConvolver convolver;
+        convolver.prepare(impulse);
+
+        // Fresh input every block: reprocessing the output would decay into denormals
+        const auto input = makeNoise(blockSize * 16);
+        std::vector<float> buffer(static_cast<size_t>(blockSize));
+        const int numBlocks = 2000 * 512 / blockSize;
+
+        const double microseconds = BenchmarkUtils::measureMicroseconds(numBlocks, [&](int block) {
+            const auto* source = input.data() + static_cast<size_t>(block % 16 * blockSize);
+            std::copy(source, source + blockSize, buffer.begin());
+            convolver.process(buffer.data(), blockSize);
+        });
+
+        return microseconds * 1000.0 / blockSize;
+    }
+
+    double measureDirect(const std::vector<float>& ir)
+    {
+        constexpr int blockSize = 512;
+        constexpr int numBlocks = 50;
+
+        const auto length = ir.size();
+        const auto input = makeNoise(static_cast<int>(length) + blockSize * numBlocks);
+        volatile float sink = 0.0f;
+
+        const double microseconds = BenchmarkUtils::measureMicroseconds(numBlocks, [&](int block) {
+            const float* samples = input.data() + length + static_cast<size_t>(block * blockSize);
+            float sum = 0.0f;
+
+            for (int i = 0; i < blockSize; ++i)
+                for (size_t t = 0; t < length; ++t)
+                    sum += ir[t] * samples[i - static_cast<std::ptrdiff_t>(t)];
+
+            sink = sink + sum;
+        });
+
+        return microseconds * 1000.0 / blockSize;
+    }
+}
+
+void runCabinetBenchmark()
+{
+    BenchmarkUtils::printHeader("Cabinet: partitioned convolution (48kHz, one channel)");
+
+    for (const int length : { 1024, 4096, 12000 })
+    {
+        const auto ir = makeImpulse(length);
+        const auto impulse = std::make_shared<const CabinetImpulse>(ir.data(), length, sampleRate, sampleRate);
+        const juce::String label = juce::String(length) + " taps";
+
+        BenchmarkUtils::printResult((label + "  host blocks 64").toRawUTF8(), measureConvolver(impulse, 64), "ns/sample");
+        BenchmarkUtils::printResult((label + "  host blocks 512").toRawUTF8(), measureConvolver(impulse, 512), "ns/sample");
+
+        if (length <= 4096)
+            BenchmarkUtils::printResult((label + "  direct form").toRawUTF8(), measureDirect(ir), "ns/sample");
+    }
+
+    // Building: resampling dominates, then the normalization and partition transforms
+    const int sourceLength = static_cast<int>(44100.0 * CabinetImpulse::maxLengthSeconds);
+    const auto source = makeImpulse(sourceLength);
+    std::shared_ptr<const CabinetImpulse> built;
+
+    const double buildTime = BenchmarkUtils::measureMicroseconds(3, [&](int) {
+        built = std::make_shared<const CabinetImpulse>(source.data(), sourceLength, 44100.0, sampleRate);
+    });
+
+    BenchmarkUtils::printResult("build 250ms IR, 44.1kHz -> 48kHz", buildTime / 1000.0, "ms");
+
+    // Spectra (shared) and delay lines (per channel) of the 250ms IR
+    const auto spectrumBytes = static_cast<double>(built->getNumPartitions()) * CabinetImpulse::binStride * 2 * sizeof(float);
+    const double sharedBytes = spectrumBytes;
+    const double perInstanceBytes = 2.0 * (spectrumBytes + sizeof(PartitionedConvolver));
+
+    BenchmarkUtils::printResult("250ms IR spectra", sharedBytes / 1024.0, "KiB");
+    BenchmarkUtils::printResult("per instance (2 channels)", perInstanceBytes / 1024.0, "KiB");
+    BenchmarkUtils::printResult("300 instances, shared spectra",
+                                (sharedBytes + numInstances * perInstanceBytes) / (1024.0 * 1024.0), "MiB");
+    BenchmarkUtils::printResult("300 instances, spectra per instance",
+                                numInstances * (sharedBytes + perInstanceBytes) / (1024.0 * 1024.0), "MiB");
+}
@@ -0,0 +1,84 @@
+#include "BenchmarkUtils.h"
+#include "PluginProcessor.h"
+
+/**
+ * InstantiationBenchmark - Project load cost per instance
+ *
+ * Replays what a host does when it opens a project with many instances:
+ * construct every processor, restore its state, prepare it, then run the
+ * first block. Repeated prepares (hosts often call prepareToPlay more than
+ * once with the same settings) and destruction are measured separately.
+ */
+namespace
+{
+    constexpr int numInstances = 300;
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+
+    // A non-default state, as a saved project would contain
+    juce::MemoryBlock createProjectState()
+    {
+        ReeseDestroyerAudioProcessor processor;
+        auto& parameters = processor.getParameters();
+
+        // Normalized values
+        const std::pair<const char*, float> changes[] = {
+            { "cutoff", 0.3f }, { "character", 0.8f }, { "ringRate", 0.6f }, { "drive", 0.7f }, { "multiband", 1.0f }
+        };
+
+        for (const auto& [id, value] : changes)
+            parameters.getParameter(id)->setValueNotifyingHost(value);
+
+        juce::MemoryBlock state;
+        processor.getStateInformation(state);
+        return state;
+    }
+}
+
+void runInstantiationBenchmark()
+{
+    BenchmarkUtils::printHeader("Instantiation / project load (per instance, 300 instances)");
+
+    const auto state = createProjectState();
+
+    std::vector<std::unique_ptr<ReeseDestroyerAudioProcessor>> instances(numInstances);
+
+    const auto construct = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        instances[(size_t) i] = std::make_unique<ReeseDestroyerAudioProcessor>();
+    });
+
+    const auto restore = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        instances[(size_t) i]->setStateInformation(state.getData(), (int) state.getSize());
+    });
+
+    const auto prepare = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        auto& processor = *instances[(size_t) i];
+        processor.setPlayConfigDetails(2, 2, sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+    });
+
+    const auto prepareAgain = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        instances[(size_t) i]->prepareToPlay(sampleRate, blockSize);
+    });
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+
+    const auto firstBlock = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        buffer.clear();
+        instances[(size_t) i]->processBlock(buffer, midi);
+    });
+
+    const auto destroy = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        instances[(size_t) i].reset();
+    });
+
+    BenchmarkUtils::printResult("constructor", construct);
+    BenchmarkUtils::printResult("setStateInformation", restore);
+    BenchmarkUtils::printResult("prepareToPlay (first)", prepare);
+    BenchmarkUtils::printResult("prepareToPlay (same settings again)", prepareAgain);
+    BenchmarkUtils::printResult("first processBlock", firstBlock);
+    BenchmarkUtils::printResult("destructor", destroy);
+    BenchmarkUtils::printResult("project load (construct + restore + prepare)",
+                                (construct + restore + prepare) * numInstances * 1.0e-3, "ms");
+}
@@ -0,0 +1,79 @@
+#include "BenchmarkUtils.h"
+#include "PluginProcessor.h"
+
+/**
+ * ParallelBenchmark - Serial vs Multi-Core channel processing
+ *
+ * Times processBlock for one stereo instance with the Multi-Core parameter
+ * off and on, across sample rate / block size pairs from the worst case for
+ * handoff overhead (192kHz, 16 samples) to a typical mixing buffer. Blocks
+ * shorter than the processor's minimum always run serially, so the
+ * smallest case shows the fallback rather than the split.
+ */
+namespace
+{
+    struct Configuration
+    {
+        double sampleRate;
+        int blockSize;
+    };
+
+    constexpr Configuration configurations[] = {
+        { 192000.0, 16 },
+        { 192000.0, 32 },
+        { 192000.0, 64 },
+        {  96000.0, 128 },
+        {  48000.0, 512 },
+    };
+
+    constexpr double secondsPerCase = 2.0;
+
+    double measureBlock(const Configuration& configuration, bool multiCore)
+    {
+        ReeseDestroyerAudioProcessor processor;
+
+        // Multiband with both band chains active: the heaviest channel pass
+        auto& parameters = processor.getParameters();
+        for (const auto* id : { "multiband", "subCharacter" })
+            parameters.getParameter(id)->setValueNotifyingHost(1.0f);
+
+        parameters.getParameter("multiCore")->setValueNotifyingHost(multiCore ? 1.0f : 0.0f);
+
+        processor.setPlayConfigDetails(2, 2, configuration.sampleRate, configuration.blockSize);
+        processor.prepareToPlay(configuration.sampleRate, configuration.blockSize);
+
+        juce::AudioBuffer<float> buffer(2, configuration.blockSize);
+        juce::MidiBuffer midi;
+        juce::Random random(1);
+
+        const int numBlocks = static_cast<int>(secondsPerCase * configuration.sampleRate / configuration.blockSize);
+
+        return BenchmarkUtils::measureMicroseconds(numBlocks, [&](int) {
+            for (int channel = 0; channel < 2; ++channel)
+                for (int sample = 0; sample < configuration.blockSize; ++sample)
+                    buffer.setSample(channel, sample, random.nextFloat() * 0.5f - 0.25f);
+
+            processor.processBlock(buffer, midi);
+        });
+    }
+}
+
+void runParallelBenchmark()
+{
+    BenchmarkUtils::printHeader("Channel processing, serial vs Multi-Core (per block)");
+
+    for (const auto& configuration : configurations)
+    {
+        const auto serial = measureBlock(configuration, false);
+        const auto parallel = measureBlock(configuration, true);
+        const double budget = 1.0e6 * configuration.blockSize / configuration.sampleRate;
+
+        const auto label = juce::String(configuration.sampleRate / 1000.0, 0) + "kHz / "
+                         + juce::String(configuration.blockSize) + " samples";
+
+        BenchmarkUtils::printResult((label + "  serial").toRawUTF8(), serial);
+        BenchmarkUtils::printResult((label + "  multi-core").toRawUTF8(), parallel);
+        BenchmarkUtils::printResult((label + "  speedup").toRawUTF8(), serial / parallel, "x");
+        BenchmarkUtils::printResult((label + "  budget").toRawUTF8(), budget);
+    }
+}
@@ -0,0 +1,58 @@
+#include "BenchmarkUtils.h"
+#include "PluginProcessor.h"
+
+/**
+ * StateBenchmark - Save/restore cost per instance
+ *
+ * Compares the legacy APVTS -> XML -> binary state with the compact binary
+ * format across a project-sized number of instances.
+ */
+namespace
+{
+    constexpr int numInstances = 300;
+
+    // Reproduces the v1.0 getStateInformation() for comparison
+    void writeLegacyState(ReeseDestroyerAudioProcessor& processor, juce::MemoryBlock& destData)
+    {
+        auto state = processor.getParameters().copyState();
+        std::unique_ptr<juce::XmlElement> xml(state.createXml());
+        juce::AudioProcessor::copyXmlToBinary(*xml, destData);
+    }
+}
+
+void runStateBenchmark()
+{
+    BenchmarkUtils::printHeader("Plugin state save/restore (per instance)");
+
+    std::vector<std::unique_ptr<ReeseDestroyerAudioProcessor>> instances;
+    for (int i = 0; i < numInstances; ++i)
+        instances.push_back(std::make_unique<ReeseDestroyerAudioProcessor>());
+
+    std::vector<juce::MemoryBlock> legacyBlobs(numInstances);
+    std::vector<juce::MemoryBlock> binaryBlobs(numInstances);
+
+    auto legacySave = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        writeLegacyState(*instances[(size_t) i], legacyBlobs[(size_t) i]);
+    });
+
+    auto binarySave = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        instances[(size_t) i]->getStateInformation(binaryBlobs[(size_t) i]);
+    });
+
+    auto legacyRestore = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        const auto& blob = legacyBlobs[(size_t) i];
+        instances[(size_t) i]->setStateInformation(blob.getData(), (int) blob.getSize());
+    });
+
+    auto binaryRestore = BenchmarkUtils::measureMicroseconds(numInstances, [&](int i) {
+        const auto& blob = binaryBlobs[(size_t) i];
+        instances[(size_t) i]->setStateInformation(blob.getData(), (int) blob.getSize());
+    });
+
+    BenchmarkUtils::printResult("save    legacy XML", legacySave);
+    BenchmarkUtils::printResult("save    binary", binarySave);
+    BenchmarkUtils::printResult("restore legacy XML", legacyRestore);
+    BenchmarkUtils::printResult("restore binary", binaryRestore);
+    BenchmarkUtils::printResult("blob size legacy XML", (double) legacyBlobs.front().getSize(), "bytes");
+    BenchmarkUtils::printResult("blob size binary", (double) binaryBlobs.front().getSize(), "bytes");
+}
@@ -0,0 +1,180 @@
+#include "AnalysisTap.h"
+
+namespace
+{
+    constexpr float minusInfinityDb = -100.0f;
+    constexpr double rmsTimeConstant = 0.3;     // Seconds (VU-style ballistics)
+    constexpr double peakFallRateDb = 20.0;     // dB per second
+    constexpr int spectrumHopSize = 512;        // New stream samples between FFTs
+    constexpr float spectrumSmoothing = 0.6f;   // Visual smoothing between frames
+    constexpr int analysisIntervalMs = 16;      // ~60 Hz
+
+    float toDb(float gain)
+    {
+        return juce::Decibels::gainToDecibels(gain, minusInfinityDb);
+    }
+}
+
+AnalysisTap::AnalysisTap()
+    : juce::Thread("Reese Analysis")
+{
+    working.peakDb.fill(minusInfinityDb);
+    working.rmsDb.fill(minusInfinityDb);
+    working.spectrumDb.fill(minusInfinityDb);
+    published = working;
+}
+
+AnalysisTap::~AnalysisTap()
+{
+    stopThread(1000);
+}
+
+//==============================================================================
+void AnalysisTap::prepare(double sampleRate)
+{
+    // Keep the spectrum stream around 11-12 kHz regardless of host rate;
+    // bass content of interest is well below its Nyquist
+    const int decimation = juce::jmax(1, juce::roundToInt(sampleRate / 12000.0));
+
+    hostSampleRate.store(sampleRate);
+    streamDecimation.store(decimation);
+    pendingSum = 0.0f;
+    pendingCount = 0;
+}
+
+AnalysisTap::BlockWriter AnalysisTap::beginBlock() noexcept
+{
+    BlockWriter writer;
+
+    if (!isActive())
+        return writer;
+
+    writer.active = true;
+    writer.stream = streamFifo.beginBatch();
+    writer.decimationFactor = streamDecimation.load(std::memory_order_relaxed);
+    writer.decimationSum = pendingSum;
+    writer.decimationCount = pendingCount;
+    return writer;
+}
+
+void AnalysisTap::commit(BlockWriter& writer, int numSamples) noexcept
+{
+    if (!writer.active)
+        return;
+
+    pendingSum = writer.decimationSum;
+    pendingCount = writer.decimationCount;
+
+    // Publish the stream samples and one level frame for the whole block
+    streamFifo.commit(writer.stream);
+    levelFifo.push({ writer.levels.peaks, writer.levels.sumSquares, writer.levels.numValues, numSamples });
+}
+
+//==============================================================================
+void AnalysisTap::addView()
+{
+    if (numViews.fetch_add(1) == 0)
+        startThread(juce::Thread::Priority::low);
+}
+
+void AnalysisTap::removeView()
+{
+    if (numViews.fetch_sub(1) == 1)
+        stopThread(1000);
+}
+
+void AnalysisTap::getSnapshot(Snapshot& destination) const
+{
+    const juce::SpinLock::ScopedLockType lock(snapshotLock);
+    destination = published;
+}
+
+//==============================================================================
+void AnalysisTap::run()
+{
+    while (!threadShouldExit())
+    {
+        processLevels();
+        processSpectrum();
+
+        {
+            const juce::SpinLock::ScopedLockType lock(snapshotLock);
+            ++working.sequence;
+            published = working;
+        }
+
+        wait(analysisIntervalMs);
+    }
+}
+
+void AnalysisTap::processLevels()
+{
+    const double sampleRate = hostSampleRate.load();
+
+    LevelFrame frame;
+    while (levelFifo.pop(frame))
+    {
+        if (frame.numValues == 0)
+            continue;
+
+        // Ballistics are applied per frame using the frame's real duration
+        const double frameSeconds = frame.numSamples / sampleRate;
+        const float rmsCoeff = static_cast<float>(std::exp(-frameSeconds / rmsTimeConstant));
+        const float peakFall = static_cast<float>(juce::Decibels::decibelsToGain(-peakFallRateDb * frameSeconds));
+
+        for (size_t path = 0; path < static_cast<size_t>(numPaths); ++path)
+        {
+            const float frameMeanSquare = frame.sumSquares[path] / static_cast<float>(frame.numValues);
+            meanSquare[path] = rmsCoeff * meanSquare[path] + (1.0f - rmsCoeff) * frameMeanSquare;
+            peakHold[path] = juce::jmax(frame.peaks[path], peakHold[path] * peakFall);
+        }
+    }
+
+    for (size_t path = 0; path < static_cast<size_t>(numPaths); ++path)
+    {
+        working.peakDb[path] = toDb(peakHold[path]);
+        working.rmsDb[path] = toDb(std::sqrt(meanSquare[path]));
+    }
+}
+
+void AnalysisTap::processSpectrum()
+{
+    // Drain the decimated output stream into the history ring
+    std::array<float, 1024> chunk;
+    size_t count;
+
+    while ((count = streamFifo.pop(chunk.data(), chunk.size())) > 0)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            history[static_cast<size_t>(historyWritePos)] = chunk[i];
+            historyWritePos = (historyWritePos + 1) & (fftSize - 1);
+        }
+
+        samplesSinceLastFFT += static_cast<int>(count);
+    }
+
+    if (samplesSinceLastFFT < spectrumHopSize)
+        return;
+
+    samplesSinceLastFFT = 0;
+
+    // Unroll the ring oldest-first, window, transform
+    for (int i = 0; i < fftSize; ++i)
+        fftData[static_cast<size_t>(i)] = history[static_cast<size_t>((historyWritePos + i) & (fftSize - 1))];
+
+    std::fill(fftData.begin() + fftSize, fftData.end(), 0.0f);
+    window.multiplyWithWindowingTable(fftData.data(), static_cast<size_t>(fftSize));
+    fft.performFrequencyOnlyForwardTransform(fftData.data());
+
+    // Hann coherent gain is 0.5: scale so a full-scale sine reads ~0 dB
+    const float scale = 4.0f / static_cast<float>(fftSize);
+
+    for (size_t bin = 0; bin < static_cast<size_t>(numSpectrumBins); ++bin)
+    {
+        const float db = toDb(fftData[bin] * scale);
+        working.spectrumDb[bin] = spectrumSmoothing * working.spectrumDb[bin] + (1.0f - spectrumSmoothing) * db;
+    }
+
+    working.streamSampleRate = hostSampleRate.load() / streamDecimation.load();
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include "SpscFifo.h"
+
+/**
+ * AnalysisTap - Lock-Free Metering and Spectrum Tap
+ *
+ * Moves all metering work off the audio thread:
+ *
+ *   processBlock                         Analysis thread               Editor(s)
+ *   ------------                         ---------------               ---------
+ *   BlockWriter accumulates per-path     drains FIFOs, computes        copy the latest
+ *   peak / sum-of-squares in registers   peak hold, RMS and an FFT     AnalysisSnapshot
+ *   and a decimated output stream   -->  spectrum, publishes a    -->  and repaint
+ *   commit(): a few stores per block     snapshot (~60 Hz)
+ *
+ * The audio thread never waits: both FIFOs are wait-free SPSC rings and
+ * drop data when full. Its cost is independent of how many views are open,
+ * and nothing is accumulated while none is (the analysis thread only runs
+ * while at least one view is attached).
+ */
+class AnalysisTap : private juce::Thread
+{
+public:
+    /**
+     * Signal paths that are metered individually
+     */
+    enum class Path
+    {
+        CLEAN,
+        OCTAVE,
+        RING,
+        COMBINED,
+        OUTPUT,
+        NUM_PATHS
+    };
+
+    static constexpr int numPaths = static_cast<int>(Path::NUM_PATHS);
+    static constexpr int fftOrder = 11;
+    static constexpr int fftSize = 1 << fftOrder;
+    static constexpr int numSpectrumBins = fftSize / 2;
+
+    /**
+     * Ready-to-draw analysis results (copied out by the editor)
+     */
+    struct Snapshot
+    {
+        std::array<float, numPaths> peakDb {};
+        std::array<float, numPaths> rmsDb {};
+        std::array<float, numSpectrumBins> spectrumDb {};
+        double streamSampleRate = 11025.0;   // Sample rate of the spectrum input
+        juce::uint32 sequence = 0;            // Increments on every publish
+    };
+
+    /**
+     * Per-path peak and sum of squares. Channels processed on different
+     * threads each fill their own and are merged into the BlockWriter.
+     */
+    struct PathLevels
+    {
+        /** One call per channel sample, before the output stage */
+        void addPaths(float clean, float octave, float ring, float combined) noexcept
+        {
+            accumulate(0, clean);
+            accumulate(1, octave);
+            accumulate(2, ring);
+            accumulate(3, combined);
+            ++numValues;
+        }
+
+        void accumulate(int path, float value) noexcept
+        {
+            const float magnitude = std::abs(value);
+            peaks[static_cast<size_t>(path)] = juce::jmax(peaks[static_cast<size_t>(path)], magnitude);
+            sumSquares[static_cast<size_t>(path)] += value * value;
+        }
+
+        void merge(const PathLevels& other) noexcept
+        {
+            for (size_t path = 0; path < static_cast<size_t>(numPaths); ++path)
+            {
+                peaks[path] = juce::jmax(peaks[path], other.peaks[path]);
+                sumSquares[path] += other.sumSquares[path];
+            }
+
+            numValues += other.numValues;
+        }
+
+        std::array<float, numPaths> peaks {};
+        std::array<float, numPaths> sumSquares {};
+        int numValues = 0;
+    };
+
+    /**
+     * Per-block recorder used on the audio thread. Accumulates in locals and
+     * writes stream samples straight into the FIFO; nothing becomes visible
+     * to the analysis thread until AnalysisTap::commit().
+     */
+    class BlockWriter
+    {
+    public:
+        /** False while no view is attached: the block is dropped, so skip accumulating it */
+        bool isActive() const noexcept { return active; }
+
+        /** One call per channel sample, before the output stage */
+        void addPaths(float clean, float octave, float ring, float combined) noexcept
+        {
+            levels.addPaths(clean, octave, ring, combined);
+        }
+
+        /** Path levels accumulated elsewhere (e.g. one channel on a worker thread) */
+        void addLevels(const PathLevels& channelLevels) noexcept
+        {
+            levels.merge(channelLevels);
+        }
+
+        /** One call per channel sample, after the output stage (limiter latency is not compensated) */
+        void addOutput(float output) noexcept
+        {
+            levels.accumulate(4, output);
+        }
+
+        /** One call per sample frame (mono sum of the output channels) */
+        void addOutputSample(float sample) noexcept
+        {
+            decimationSum += sample;
+
+            if (++decimationCount == decimationFactor)
+            {
+                stream.push(decimationSum / static_cast<float>(decimationFactor));
+                decimationSum = 0.0f;
+                decimationCount = 0;
+            }
+        }
+
+    private:
+        friend class AnalysisTap;
+
+        PathLevels levels;
+
+        SpscFifo<float, 16384>::Batch stream;
+        float decimationSum = 0.0f;
+        int decimationCount = 0;
+        int decimationFactor = 4;
+        bool active = false;
+    };
+
+    AnalysisTap();
+    ~AnalysisTap() override;
+
+    //==============================================================================
+    // Audio thread
+
+    /**
+     * Prepare for a new sample rate (chooses the stream decimation factor)
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * True while at least one view is attached; skip all tap work otherwise
+     */
+    bool isActive() const noexcept { return numViews.load(std::memory_order_relaxed) > 0; }
+
+    BlockWriter beginBlock() noexcept;
+    void commit(BlockWriter& writer, int numSamples) noexcept;
+
+    //==============================================================================
+    // Message thread
+
+    /**
+     * Attach/detach a view; the analysis thread runs while any view is attached
+     */
+    void addView();
+    void removeView();
+
+    /**
+     * Copy the most recent snapshot
+     */
+    void getSnapshot(Snapshot& destination) const;
+
+private:
+    //==============================================================================
+    struct LevelFrame
+    {
+        std::array<float, numPaths> peaks;
+        std::array<float, numPaths> sumSquares;
+        int numValues;
+        int numSamples;
+    };
+
+    void run() override;
+    void processLevels();
+    void processSpectrum();
+
+    //==============================================================================
+    // Shared between threads
+    SpscFifo<LevelFrame, 256> levelFifo;
+    SpscFifo<float, 16384> streamFifo;
+    std::atomic<int> numViews { 0 };
+    std::atomic<double> hostSampleRate { 44100.0 };
+    std::atomic<int> streamDecimation { 4 };
+
+    // Carried across blocks on the audio thread (decimator state)
+    float pendingSum = 0.0f;
+    int pendingCount = 0;
+
+    // Analysis thread state
+    std::array<float, numPaths> peakHold {};
+    std::array<float, numPaths> meanSquare {};
+    std::array<float, fftSize> history {};
+    int historyWritePos = 0;
+    int samplesSinceLastFFT = 0;
+    juce::dsp::FFT fft { fftOrder };
+    juce::dsp::WindowingFunction<float> window { static_cast<size_t>(fftSize),
+                                                 juce::dsp::WindowingFunction<float>::hann, false };
+    std::array<float, fftSize * 2> fftData {};
+    Snapshot working;
+
+    // Published result
+    mutable juce::SpinLock snapshotLock;
+    Snapshot published;
+
+    JUCE_DECLARE_NON_COPYABLE(AnalysisTap)
+};
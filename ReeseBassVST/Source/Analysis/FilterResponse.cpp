@@ -0,0 +1,216 @@
+#include "FilterResponse.h"
+#include "../DSP/SimdFloat.h"
+
+namespace
+{
+    // Quantization of the cache key: 1/48 octave cutoff steps, 0.25% resonance steps
+    constexpr float cutoffStepsPerOctave = 48.0f;
+    constexpr float resonanceSteps = 400.0f;
+    constexpr float floorDb = -120.0f;
+
+    static_assert(FilterResponse::numPoints % SimdFloat::width == 0,
+                  "Grid size must be a multiple of the SIMD width");
+}
+
+FilterResponse::FilterResponse()
+    : juce::Thread("Reese Filter Response")
+{
+}
+
+FilterResponse::~FilterResponse()
+{
+    stopThread(1000);
+}
+
+//==============================================================================
+float FilterResponse::getGridFrequency(int index)
+{
+    const float proportion = static_cast<float>(index) / static_cast<float>(numPoints - 1);
+    return minFrequency * std::pow(maxFrequency / minFrequency, proportion);
+}
+
+void FilterResponse::setSampleRate(double sampleRate)
+{
+    if (sampleRate != currentSampleRate.load())
+    {
+        currentSampleRate.store(sampleRate);
+        ++rateGeneration;   // Old cache entries can no longer match
+    }
+}
+
+void FilterResponse::addView()
+{
+    if (numViews.fetch_add(1) == 0)
+        startThread(juce::Thread::Priority::low);
+}
+
+void FilterResponse::removeView()
+{
+    if (numViews.fetch_sub(1) == 1)
+        stopThread(1000);
+}
+
+//==============================================================================
+juce::uint64 FilterResponse::makeKey(Model model, float cutoffHz, float resonance, juce::uint32 generation)
+{
+    const auto cutoffIndex = static_cast<juce::uint64>(juce::jmax(0, juce::roundToInt(
+        std::log2(juce::jmax(minFrequency, cutoffHz) / minFrequency) * cutoffStepsPerOctave)));
+    const auto resonanceIndex = static_cast<juce::uint64>(juce::jmax(0, juce::roundToInt(resonance * resonanceSteps)));
+
+    const auto modelBit = static_cast<juce::uint64>(model == Model::LADDER ? 1 : 0);
+
+    return (static_cast<juce::uint64>(generation) << 32) | (modelBit << 31) | (cutoffIndex << 16) | resonanceIndex;
+}
+
+void FilterResponse::decodeKey(juce::uint64 key, Model& model, float& cutoffHz, float& resonance)
+{
+    model = ((key >> 31) & 1) != 0 ? Model::LADDER : Model::SVF;
+
+    const auto cutoffIndex = static_cast<float>((key >> 16) & 0x7fff);
+    const auto resonanceIndex = static_cast<float>(key & 0xffff);
+
+    cutoffHz = minFrequency * std::exp2(cutoffIndex / cutoffStepsPerOctave);
+    resonance = resonanceIndex / resonanceSteps;
+}
+
+bool FilterResponse::getCurve(Model model, float cutoffHz, float resonance, Curve& destination)
+{
+    const auto key = makeKey(model, cutoffHz, resonance, rateGeneration.load());
+
+    {
+        const juce::SpinLock::ScopedLockType lock(cacheLock);
+
+        for (auto& entry : cache)
+        {
+            if (entry.valid && entry.curve.key == key)
+            {
+                entry.lastUsed = ++useCounter;
+                destination = entry.curve;
+                return true;
+            }
+        }
+    }
+
+    // Miss: only the latest request matters while the user drags a knob
+    pendingKey.store(key);
+    notify();
+    return false;
+}
+
+//==============================================================================
+void FilterResponse::run()
+{
+    while (!threadShouldExit())
+    {
+        const auto key = pendingKey.exchange(0);
+
+        if (key == 0 || (key >> 32) != rateGeneration.load())
+        {
+            wait(-1);
+            continue;
+        }
+
+        const double sampleRate = currentSampleRate.load();
+        if (sampleRate != gridSampleRate)
+            rebuildGrid(sampleRate);
+
+        Model model;
+        float cutoffHz, resonance;
+        decodeKey(key, model, cutoffHz, resonance);
+
+        Curve curve;
+        curve.key = key;
+        evaluate(model, cutoffHz, resonance, curve);
+
+        // Insert, replacing an invalid or the least recently used entry
+        const juce::SpinLock::ScopedLockType lock(cacheLock);
+
+        auto* victim = &cache.front();
+        for (auto& entry : cache)
+        {
+            if (!entry.valid)
+            {
+                victim = &entry;
+                break;
+            }
+
+            if (entry.lastUsed < victim->lastUsed)
+                victim = &entry;
+        }
+
+        victim->curve = curve;
+        victim->lastUsed = ++useCounter;
+        victim->valid = true;
+    }
+}
+
+void FilterResponse::rebuildGrid(double sampleRate)
+{
+    gridSampleRate = sampleRate;
+    const double nyquistLimit = sampleRate * 0.4999;
+
+    for (int i = 0; i < numPoints; ++i)
+    {
+        // Points at/above Nyquist do not exist in the digital filter; push them to "infinite" t
+        const double hz = juce::jmin(static_cast<double>(getGridFrequency(i)), nyquistLimit);
+        tanHalfOmega[static_cast<size_t>(i)] = static_cast<float>(std::tan(juce::MathConstants<double>::pi * hz / sampleRate));
+    }
+}
+
+void FilterResponse::evaluate(Model model, float cutoffHz, float resonance, Curve& curve) const
+{
+    // Same coefficient mapping as StateVariableFilter / LadderFilter::updateCoefficients()
+    const double clampedCutoff = juce::jlimit(20.0, gridSampleRate * 0.49, static_cast<double>(cutoffHz));
+    const float g = static_cast<float>(std::tan(juce::MathConstants<double>::pi * clampedCutoff / gridSampleRate));
+    const float clampedResonance = juce::jlimit(0.0f, 0.95f, resonance);
+
+    const auto invG = SimdFloat::broadcast(1.0f / g);
+    const auto one = SimdFloat::broadcast(1.0f);
+
+    // SIMD across grid points
+    alignas(SimdFloat::alignment) std::array<float, numPoints> magnitudeSquared;
+
+    if (model == Model::LADDER)
+    {
+        // |H|^2 = (1 + k)^2 / ((1 - 6t^2 + t^4 + k)^2 + (4t - 4t^3)^2)
+        const float k = clampedResonance * 4.0f;
+        const auto onePlusK = SimdFloat::broadcast(1.0f + k);
+        const auto six = SimdFloat::broadcast(6.0f);
+        const auto four = SimdFloat::broadcast(4.0f);
+
+        for (int i = 0; i < numPoints; i += SimdFloat::width)
+        {
+            const auto t = SimdFloat::load(tanHalfOmega.data() + i) * invG;
+            const auto tSquared = t * t;
+            const auto real = onePlusK - six * tSquared + tSquared * tSquared;
+            const auto imaginary = four * t * (one - tSquared);
+            const auto denominator = real * real + imaginary * imaginary;
+
+            (onePlusK * onePlusK / denominator).store(magnitudeSquared.data() + i);
+        }
+    }
+    else
+    {
+        // |H|^2 = 1 / ((1 - t^2)^2 + k^2 t^2)
+        const float Q = 0.5f + (clampedResonance * 19.5f);
+        const float k = 1.0f / Q;
+        const auto kSquared = SimdFloat::broadcast(k * k);
+
+        for (int i = 0; i < numPoints; i += SimdFloat::width)
+        {
+            const auto t = SimdFloat::load(tanHalfOmega.data() + i) * invG;
+            const auto tSquared = t * t;
+            const auto a = one - tSquared;
+            const auto denominator = a * a + kSquared * tSquared;
+
+            (one / denominator).store(magnitudeSquared.data() + i);
+        }
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(numPoints); ++i)
+    {
+        const float db = juce::jmax(floorDb, 10.0f * std::log10(juce::jmax(magnitudeSquared[i], 1.0e-12f)));
+        curve.singleDb[i] = db;
+        curve.cascadeDb[i] = juce::jmax(floorDb, 2.0f * db);
+    }
+}
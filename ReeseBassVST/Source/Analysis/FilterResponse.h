@@ -0,0 +1,118 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+
+/**
+ * FilterResponse - Background-Computed Filter Magnitude Curves
+ *
+ * Evaluates the analytic magnitude response of the chain's low-pass filter
+ * model on a log-spaced frequency grid, on a worker thread. Both models are
+ * trapezoidal, so with g = tan(pi * fc / fs) each is its analog prototype
+ * under s = j * tan(w/2) / g (w = 2*pi*f/fs), and with t = tan(pi*f/fs) / g:
+ *
+ * StateVariableFilter (Zavalishin), k = 1/Q:
+ *   H(s) = 1 / (s^2 + k*s + 1)
+ *   => |H(f)|^2 = 1 / ((1 - t^2)^2 + (k*t)^2)
+ *
+ * LadderFilter, linearized (small signals: every tanh slope is 1), with
+ * feedback k = 4 * resonance and the (1 + k) passband gain compensation:
+ *   H(s) = (1 + k) / ((1 + s)^4 + k)
+ *   => |H(f)|^2 = (1 + k)^2 / ((1 - 6t^2 + t^4 + k)^2 + (4t - 4t^3)^2)
+ *
+ * tan(pi*f/fs) only depends on the grid and sample rate, so it is tabulated
+ * once; each curve is then a handful of multiply/adds per point, evaluated
+ * SimdFloat::width points at a time.
+ *
+ * Curves are cached by model and quantized (cutoff, resonance). The editor asks for a
+ * curve every frame: cache hits are a copy, misses queue a request and the
+ * editor keeps drawing the previous curve until the worker has filled the
+ * cache. Neither the message thread nor the audio thread ever evaluates a
+ * curve.
+ */
+class FilterResponse : private juce::Thread
+{
+public:
+    static constexpr int numPoints = 256;
+    static constexpr float minFrequency = 20.0f;
+    static constexpr float maxFrequency = 20000.0f;
+
+    // Filter model of the chain paths (the Filter Model parameter's values)
+    enum class Model
+    {
+        SVF,      // StateVariableFilter, 12dB/octave
+        LADDER    // LadderFilter, 24dB/octave
+    };
+
+    /**
+     * One evaluated response
+     */
+    struct Curve
+    {
+        std::array<float, numPoints> singleDb {};    // One filter (octave / ring paths)
+        std::array<float, numPoints> cascadeDb {};   // filter1 -> filter3 (combined path)
+        juce::uint64 key = 0;
+    };
+
+    FilterResponse();
+    ~FilterResponse() override;
+
+    /**
+     * Frequency (Hz) of each grid point; identical for every curve
+     */
+    static float getGridFrequency(int index);
+
+    /**
+     * Set the host sample rate (cheap, any thread; invalidates cached curves)
+     */
+    void setSampleRate(double sampleRate);
+
+    /**
+     * Attach/detach a view; the worker thread runs while any view is attached
+     */
+    void addView();
+    void removeView();
+
+    /**
+     * Fetch the curve for the given settings (message thread)
+     * @return True if found in the cache; otherwise a request is queued
+     */
+    bool getCurve(Model model, float cutoffHz, float resonance, Curve& destination);
+
+private:
+    //==============================================================================
+    static constexpr int cacheSize = 64;
+
+    struct CacheEntry
+    {
+        Curve curve;
+        juce::uint32 lastUsed = 0;
+        bool valid = false;
+    };
+
+    static juce::uint64 makeKey(Model model, float cutoffHz, float resonance, juce::uint32 rateGeneration);
+    static void decodeKey(juce::uint64 key, Model& model, float& cutoffHz, float& resonance);
+
+    void run() override;
+    void rebuildGrid(double sampleRate);
+    void evaluate(Model model, float cutoffHz, float resonance, Curve& curve) const;
+
+    //==============================================================================
+    // Request / configuration (message thread -> worker)
+    std::atomic<juce::uint64> pendingKey { 0 };
+    std::atomic<double> currentSampleRate { 44100.0 };
+    std::atomic<juce::uint32> rateGeneration { 1 };
+    std::atomic<int> numViews { 0 };
+
+    // Worker-only state
+    alignas(32) std::array<float, numPoints> tanHalfOmega {};   // tan(pi*f/fs) per grid point
+    double gridSampleRate = 0.0;
+
+    // Cache (shared by worker and message thread, never the audio thread)
+    juce::SpinLock cacheLock;
+    std::array<CacheEntry, cacheSize> cache;
+    juce::uint32 useCounter = 0;
+
+    JUCE_DECLARE_NON_COPYABLE(FilterResponse)
+};
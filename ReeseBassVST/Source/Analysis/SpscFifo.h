@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * SpscFifo - Wait-Free Single-Producer / Single-Consumer Ring Buffer
+ *
+ * Fixed capacity (power of two), no allocation, no locks. The producer is the
+ * audio thread, the consumer a background thread. Neither side ever waits:
+ * a full FIFO drops new items, an empty one returns nothing.
+ *
+ * Head and tail are free-running counters on separate cache lines; the slot
+ * index is (counter & mask). The producer can batch many writes and publish
+ * them with a single release store (see Batch).
+ */
+template <typename T, size_t Capacity>
+class SpscFifo
+{
+public:
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "FIFO items are copied with plain stores");
+
+    /**
+     * Producer-side batch: reserves the current free space once, accepts
+     * writes into it, and becomes visible to the consumer on commit()
+     */
+    class Batch
+    {
+    public:
+        bool push(const T& item) noexcept
+        {
+            if (head == limit)
+                return false;
+
+            fifo->items[head & mask] = item;
+            ++head;
+            return true;
+        }
+
+    private:
+        friend class SpscFifo;
+        SpscFifo* fifo = nullptr;
+        size_t head = 0;
+        size_t limit = 0;
+    };
+
+    //==============================================================================
+    // Producer (audio thread)
+
+    Batch beginBatch() noexcept
+    {
+        Batch batch;
+        batch.fifo = this;
+        batch.head = head.load(std::memory_order_relaxed);
+        batch.limit = tail.load(std::memory_order_acquire) + Capacity;
+        return batch;
+    }
+
+    void commit(const Batch& batch) noexcept
+    {
+        head.store(batch.head, std::memory_order_release);
+    }
+
+    bool push(const T& item) noexcept
+    {
+        auto batch = beginBatch();
+        if (!batch.push(item))
+            return false;
+
+        commit(batch);
+        return true;
+    }
+
+    //==============================================================================
+    // Consumer (background thread)
+
+    bool pop(T& item) noexcept
+    {
+        return pop(&item, 1) == 1;
+    }
+
+    size_t pop(T* dest, size_t maxItems) noexcept
+    {
+        const auto currentTail = tail.load(std::memory_order_relaxed);
+        const auto available = head.load(std::memory_order_acquire) - currentTail;
+        const auto count = available < maxItems ? available : maxItems;
+
+        for (size_t i = 0; i < count; ++i)
+            dest[i] = items[(currentTail + i) & mask];
+
+        tail.store(currentTail + count, std::memory_order_release);
+        return count;
+    }
+
+    size_t getNumReady() const noexcept
+    {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t mask = Capacity - 1;
+
+    std::array<T, Capacity> items {};
+
+    alignas(64) std::atomic<size_t> head { 0 };   // Written by producer
+    alignas(64) std::atomic<size_t> tail { 0 };   // Written by consumer
+};
@@ -0,0 +1,253 @@
+#include "CabinetLoader.h"
+#include <map>
+
+namespace
+{
+    // Loader thread poll interval while a cabinet is being handed over, and otherwise
+    constexpr int busyInterval = 20;
+    constexpr int idleInterval = 500;
+
+    // Extra source samples read past maxLengthSeconds, for the resampler's kernel
+    constexpr int resamplerMargin = 256;
+
+    // Weak references: the instances' cabinets own the impulses
+    struct ImpulseRegistry
+    {
+        juce::CriticalSection lock;
+        std::map<juce::String, std::weak_ptr<const CabinetImpulse>> impulses;
+    };
+
+    ImpulseRegistry& getRegistry()
+    {
+        static ImpulseRegistry registry;
+        return registry;
+    }
+}
+
+//==============================================================================
+class CabinetLoader::LoaderThread : public juce::TimeSliceThread
+{
+public:
+    LoaderThread() : juce::TimeSliceThread("Reese Cabinet Loader")
+    {
+        startThread(juce::Thread::Priority::low);
+    }
+
+    ~LoaderThread() override
+    {
+        stopThread(2000);
+    }
+};
+
+//==============================================================================
+CabinetLoader::CabinetLoader()
+{
+}
+
+CabinetLoader::~CabinetLoader()
+{
+    if (thread.has_value())
+        (*thread)->removeTimeSliceClient(this);
+
+    thread.reset();
+
+    // The audio thread has stopped: every slot can go
+    delete active;
+    delete incoming.exchange(nullptr);
+    delete outgoing.exchange(nullptr);
+}
+
+//==============================================================================
+void CabinetLoader::load(const juce::File& file)
+{
+    const juce::ScopedLock scopedLock(lock);
+
+    if (file == request.file && status.load() != Status::FAILED)
+        return;
+
+    requestBuild(file);
+}
+
+void CabinetLoader::clear()
+{
+    const juce::ScopedLock scopedLock(lock);
+
+    // Nothing loaded (most instances): no need to start the thread
+    if (request.file == juce::File() && status.load() == Status::EMPTY)
+        return;
+
+    requestBuild({});
+}
+
+void CabinetLoader::requestBuild(const juce::File& file)
+{
+    request.file = file;
+    ++request.generation;
+    status = file == juce::File() ? Status::EMPTY : Status::LOADING;
+
+    if (!thread.has_value())
+    {
+        thread.emplace();
+        (*thread)->addTimeSliceClient(this);
+    }
+
+    (*thread)->moveToFrontOfQueue(this);
+}
+
+void CabinetLoader::prepare(double sampleRate)
+{
+    {
+        const juce::ScopedLock scopedLock(lock);
+
+        if (sampleRate != request.sampleRate)
+        {
+            request.sampleRate = sampleRate;
+
+            if (request.file != juce::File())
+            {
+                ++request.generation;
+                status = Status::LOADING;
+            }
+        }
+    }
+
+    // The audio thread is stopped while the host prepares
+    deleteRetired();
+    buildPending();
+}
+
+//==============================================================================
+int CabinetLoader::useTimeSlice()
+{
+    deleteRetired();
+    buildPending();
+
+    const bool handingOver = incoming.load() != nullptr || outgoing.load() != nullptr;
+    return handingOver ? busyInterval : idleInterval;
+}
+
+void CabinetLoader::buildPending()
+{
+    Request pending;
+
+    {
+        const juce::ScopedLock scopedLock(lock);
+
+        // Files wait for the first prepare() to know the sample rate
+        if (request.generation == builtGeneration || request.sampleRate <= 0.0)
+            return;
+
+        pending = request;
+    }
+
+    auto cabinet = std::make_unique<Cabinet>();
+
+    if (pending.file != juce::File())
+    {
+        cabinet->impulse = makeImpulse(pending.file, pending.sampleRate);
+
+        if (cabinet->impulse != nullptr)
+            for (auto& convolver : cabinet->convolvers)
+                convolver.prepare(cabinet->impulse);
+    }
+
+    {
+        const juce::ScopedLock scopedLock(lock);
+
+        // Superseded by a newer request, or already built by another thread
+        if (pending.generation != request.generation || pending.generation == builtGeneration)
+            return;
+
+        builtGeneration = pending.generation;
+
+        const auto* impulse = cabinet->impulse.get();
+        lengthSeconds = impulse != nullptr ? impulse->getLength() / impulse->getSampleRate() : 0.0;
+        status = pending.file == juce::File() ? Status::EMPTY
+               : impulse != nullptr           ? Status::READY
+                                              : Status::FAILED;
+
+        // A cabinet the audio thread never picked up is replaced directly
+        delete incoming.exchange(cabinet.release());
+    }
+
+    sendChangeMessage();
+}
+
+std::shared_ptr<const CabinetImpulse> CabinetLoader::makeImpulse(const juce::File& file, double sampleRate)
+{
+    if (!file.existsAsFile())
+        return nullptr;
+
+    const auto key = file.getFullPathName() + "|" + juce::String(file.getSize())
+                   + "|" + juce::String(file.getLastModificationTime().toMilliseconds())
+                   + "|" + juce::String(sampleRate);
+
+    // Held while building, so instances loading the same file build it once
+    auto& registry = getRegistry();
+    const juce::ScopedLock scopedLock(registry.lock);
+
+    if (const auto found = registry.impulses.find(key); found != registry.impulses.end())
+        if (auto impulse = found->second.lock())
+            return impulse;
+
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    const std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->sampleRate <= 0.0)
+        return nullptr;
+
+    // Only what can survive the truncation to maxLengthSeconds
+    const auto maxSamples = static_cast<juce::int64>(std::ceil(reader->sampleRate * CabinetImpulse::maxLengthSeconds)) + resamplerMargin;
+    const auto numSamples = static_cast<int>(juce::jmin(reader->lengthInSamples, maxSamples));
+    const int numChannels = juce::jlimit(1, 2, static_cast<int>(reader->numChannels));
+
+    juce::AudioBuffer<float> buffer(numChannels, numSamples);
+
+    if (!reader->read(&buffer, 0, numSamples, 0, true, numChannels > 1))
+        return nullptr;
+
+    // Stereo IRs are summed to mono: every channel of the plugin uses the same response
+    if (numChannels > 1)
+    {
+        buffer.addFrom(0, 0, buffer, 1, 0, numSamples);
+        buffer.applyGain(0, 0, numSamples, 0.5f);
+    }
+
+    auto impulse = std::make_shared<const CabinetImpulse>(buffer.getReadPointer(0), numSamples,
+                                                          reader->sampleRate, sampleRate);
+
+    for (auto entry = registry.impulses.begin(); entry != registry.impulses.end();)
+        entry = entry->second.expired() ? registry.impulses.erase(entry) : std::next(entry);
+
+    registry.impulses[key] = impulse;
+    return impulse;
+}
+
+void CabinetLoader::deleteRetired()
+{
+    delete outgoing.exchange(nullptr);
+}
+
+//==============================================================================
+CabinetLoader::Cabinet* CabinetLoader::getCabinet() noexcept
+{
+    // Swap only once the previous cabinet has been collected, so nothing is freed here
+    if (outgoing.load(std::memory_order_acquire) == nullptr)
+    {
+        if (auto* next = incoming.exchange(nullptr, std::memory_order_acq_rel))
+        {
+            outgoing.store(active, std::memory_order_release);
+            active = next;
+        }
+    }
+
+    return active;
+}
+
+juce::File CabinetLoader::getFile() const
+{
+    const juce::ScopedLock scopedLock(lock);
+    return request.file;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_events/juce_events.h>
+#include <array>
+#include <atomic>
+#include <optional>
+#include "DSP/PartitionedConvolver.h"
+
+/**
+ * CabinetLoader - Cabinet IR Files, Loaded Off the Audio Thread
+ *
+ * Reads an impulse response file, builds its CabinetImpulse at the host
+ * sample rate, and hands the audio thread a ready Cabinet (the impulse plus
+ * one convolver per channel) without it ever allocating, locking or freeing:
+ *
+ *   load()/prepare() ──> build on the loader thread (or in prepare()) ──> incoming
+ *   audio thread: getCabinet() swaps incoming in, the previous one out ──> outgoing
+ *   loader thread deletes outgoing
+ *
+ * Loads run on one process-wide low-priority thread, started by the first
+ * instance that loads a file. CabinetImpulses are shared by file (path, size,
+ * modification time) and sample rate, so a project with the same cabinet on
+ * every track conforms and transforms the IR once and keeps one copy of its
+ * spectra; each instance only owns its convolvers' input history.
+ *
+ * prepare() builds synchronously when the sample rate changed or a load is
+ * still pending, so offline renders that restore state and prepare right
+ * away start with the cabinet in place. A file that cannot be read leaves
+ * the stage off (getStatus() == FAILED) but keeps its path for the state.
+ */
+class CabinetLoader : private juce::TimeSliceClient,
+                      public juce::ChangeBroadcaster
+{
+public:
+    static constexpr int maxChannels = 2;
+
+    /**
+     * One cabinet as the audio thread uses it
+     */
+    struct Cabinet
+    {
+        std::shared_ptr<const CabinetImpulse> impulse;   // Null when no file is loaded
+        std::array<PartitionedConvolver, maxChannels> convolvers;
+    };
+
+    enum class Status
+    {
+        EMPTY,
+        LOADING,
+        READY,
+        FAILED
+    };
+
+    CabinetLoader();
+    ~CabinetLoader() override;
+
+    /**
+     * Load an IR file in the background (any thread but the audio thread).
+     * Loading the file already loaded does nothing
+     */
+    void load(const juce::File& file);
+
+    /**
+     * Remove the cabinet (in the background, like load())
+     */
+    void clear();
+
+    /**
+     * The host sample rate; builds now if the cabinet is missing or was built for another rate
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * Audio thread: the current cabinet, picking up a newly built one (nullptr until the first build)
+     */
+    Cabinet* getCabinet() noexcept;
+
+    juce::File getFile() const;
+    Status getStatus() const noexcept { return status.load(); }
+
+    /**
+     * Length of the loaded IR in seconds (0 without one), for the tail length
+     */
+    double getLengthSeconds() const noexcept { return lengthSeconds.load(); }
+
+private:
+    //==============================================================================
+    class LoaderThread;
+
+    struct Request
+    {
+        juce::File file;
+        double sampleRate = 0.0;
+        int generation = 0;
+    };
+
+    int useTimeSlice() override;
+
+    // Builds the latest request if it is not built yet (any non-audio thread)
+    void buildPending();
+
+    // Reads the file and builds the impulse (shared when another instance has it); nullptr on failure
+    static std::shared_ptr<const CabinetImpulse> makeImpulse(const juce::File& file, double sampleRate);
+
+    void requestBuild(const juce::File& file);
+    void deleteRetired();
+
+    //==============================================================================
+    // Requests (guarded by lock; the audio thread never takes it)
+    juce::CriticalSection lock;
+    Request request;
+    int builtGeneration = 0;
+    std::optional<juce::SharedResourcePointer<LoaderThread>> thread;
+
+    std::atomic<Status> status { Status::EMPTY };
+    std::atomic<double> lengthSeconds { 0.0 };
+
+    // Hand-over slots: built -> audio thread -> deleted
+    std::atomic<Cabinet*> incoming { nullptr };
+    std::atomic<Cabinet*> outgoing { nullptr };
+    Cabinet* active = nullptr;   // Audio thread
+
+    JUCE_DECLARE_NON_COPYABLE(CabinetLoader)
+};
@@ -0,0 +1,389 @@
+#include "BatchedReeseEngine.h"
+#include "ReeseChain.h"
+#include <cassert>
+#include <numbers>
+
+namespace
+{
+    using Vec = SimdFloat;
+
+    // OctaveDivider comparator: default threshold + hysteresis
+    constexpr float octaveTrigger = 0.005f + 0.002f;
+
+    // WaveShapers::multiStage at its default character (0.5), and its output gain
+    constexpr float shaperStageAmount = 2.0f;
+    constexpr float shaperOutputGain = 0.7f;
+
+    /**
+     * tanh, within 2e-7 of std::tanh for all inputs: Lambert's [7/6] continued
+     * fraction on x/2 (clamped where tanh is already 1 in float), then
+     * tanh(2y) = 2t / (1 + t*t)
+     */
+    Vec tanhApprox(Vec x) noexcept
+    {
+        const auto limit = Vec::broadcast(9.0f);
+        const auto y = Vec::min(Vec::max(x, Vec::broadcast(0.0f) - limit), limit) * Vec::broadcast(0.5f);
+        const auto y2 = y * y;
+
+        const auto numerator = y * (Vec::broadcast(135135.0f) + y2 * (Vec::broadcast(17325.0f) + y2 * (Vec::broadcast(378.0f) + y2)));
+        const auto denominator = Vec::broadcast(135135.0f) + y2 * (Vec::broadcast(62370.0f) + y2 * (Vec::broadcast(3150.0f) + y2 * Vec::broadcast(28.0f)));
+        const auto t = numerator / denominator;
+
+        return (t + t) / (Vec::broadcast(1.0f) + t * t);
+    }
+
+    /**
+     * sin(2 pi phase) for phase in [0, 1): folded to [-1/4, 1/4] of a cycle,
+     * then the Taylor series to the 11th power (error below 1e-7)
+     */
+    Vec sinCycle(Vec phase) noexcept
+    {
+        const auto half = Vec::broadcast(0.5f);
+        const auto one = Vec::broadcast(1.0f);
+
+        // [0, 1/4] -> p, [1/4, 3/4] -> 1/2 - p, [3/4, 1) -> p - 1
+        const auto folded = Vec::max(Vec::min(phase, half - phase), phase - one);
+        const auto a = folded * Vec::broadcast(2.0f * std::numbers::pi_v<float>);
+        const auto a2 = a * a;
+
+        auto series = Vec::broadcast(-1.0f / 39916800.0f);
+        series = series * a2 + Vec::broadcast(1.0f / 362880.0f);
+        series = series * a2 + Vec::broadcast(-1.0f / 5040.0f);
+        series = series * a2 + Vec::broadcast(1.0f / 120.0f);
+        series = series * a2 + Vec::broadcast(-1.0f / 6.0f);
+
+        return a + a * a2 * series;
+    }
+
+    /**
+     * RingModulator gain at a phase (modified sine LFO, unipolar, scaled by depth)
+     */
+    Vec ringGain(Vec phase, Vec depth) noexcept
+    {
+        const auto one = Vec::broadcast(1.0f);
+
+        // sin(3x) = sin(x) * (3 - 4 sin^2(x))
+        const auto fundamental = sinCycle(phase);
+        const auto harmonic = fundamental * (Vec::broadcast(3.0f) - Vec::broadcast(4.0f) * fundamental * fundamental);
+        const auto lfo = tanhApprox((fundamental + Vec::broadcast(0.15f) * harmonic) * Vec::broadcast(1.3f));
+
+        const auto unipolar = (lfo + one) * Vec::broadcast(0.5f);
+        return one - depth * (one - unipolar);
+    }
+
+    Vec advancePhase(Vec phase, Vec increment) noexcept
+    {
+        const auto one = Vec::broadcast(1.0f);
+        phase += increment;
+        return Vec::select(Vec::lessThan(phase, one), phase, phase - one);
+    }
+
+    /**
+     * StateVariableFilter::processSample (unit drive), low-pass output
+     */
+    Vec svfLowPass(Vec input, Vec g, Vec k, Vec d, Vec& ic1, Vec& ic2) noexcept
+    {
+        const auto x = tanhApprox(input * Vec::broadcast(1.5f)) * Vec::broadcast(1.0f / 1.5f);
+
+        const auto hp = (x - (k + g) * ic1 - ic2) * d;
+        const auto bp = g * hp + ic1;
+        ic1 = g * hp + bp;
+
+        const auto lp = g * bp + ic2;
+        ic2 = g * bp + lp;
+
+        // Same denormal guard as the scalar filter
+        const auto tiny = Vec::broadcast(1e-10f);
+        const auto zero = Vec::broadcast(0.0f);
+        ic1 = Vec::select(Vec::lessThan(Vec::abs(ic1), tiny), zero, ic1);
+        ic2 = Vec::select(Vec::lessThan(Vec::abs(ic2), tiny), zero, ic2);
+
+        return lp;
+    }
+
+    /**
+     * WaveShapers::process in its default multi-stage mode
+     */
+    Vec shape(Vec input, Vec drive) noexcept
+    {
+        auto x = tanhApprox(input * drive * Vec::broadcast(1.5f)) * Vec::broadcast(1.0f / 1.5f);
+        x = tanhApprox(x * Vec::broadcast(shaperStageAmount)) * Vec::broadcast(1.0f / shaperStageAmount);
+
+        // Asymmetric stage: harder positive half, softer and quieter negative half
+        const auto y = x * Vec::broadcast(1.2f);
+        const auto positive = Vec::greaterThan(y, Vec::broadcast(0.0f));
+        const auto asymmetric = tanhApprox(y * Vec::select(positive, Vec::broadcast(1.8f), Vec::broadcast(1.2f)))
+                              * Vec::select(positive, Vec::broadcast(1.0f), Vec::broadcast(0.9f));
+
+        return asymmetric * Vec::broadcast(shaperOutputGain / 1.2f);
+    }
+
+    /**
+     * The processor's soft knee output stage
+     */
+    Vec softKnee(Vec input) noexcept
+    {
+        const auto threshold = Vec::broadcast(0.9f);
+        const auto magnitude = Vec::abs(input);
+        const auto knee = threshold + tanhApprox((magnitude - threshold) * Vec::broadcast(5.0f)) * Vec::broadcast(0.1f);
+        const auto signedKnee = Vec::select(Vec::greaterThan(input, Vec::broadcast(0.0f)), knee, Vec::broadcast(0.0f) - knee);
+
+        return Vec::select(Vec::lessThan(magnitude, threshold), input, signedKnee);
+    }
+}
+
+//==============================================================================
+BatchedReeseEngine::BatchedReeseEngine()
+{
+}
+
+void BatchedReeseEngine::prepare(double newSampleRate, int newNumInstances)
+{
+    sampleRate = newSampleRate;
+    numInstances = std::max(0, newNumInstances);
+
+    const int numGroups = (numInstances + width - 1) / width;
+    groups.assign(static_cast<size_t>(numGroups), Group {});
+
+    // Seeded like NoiseGenerator, so each lane's noise matches a plugin channel
+    noiseSources.clear();
+    for (int instance = 0; instance < numInstances; ++instance)
+    {
+#if REESE_DETERMINISTIC_NOISE
+        noiseSources.emplace_back(0x5eed);
+#else
+        noiseSources.emplace_back(std::random_device{}());
+#endif
+    }
+
+    laneInput.assign(static_cast<size_t>(subBlockSize * width), 0.0f);
+    laneNoise.assign(static_cast<size_t>(subBlockSize * width), 0.0f);
+    laneOutput.assign(static_cast<size_t>(subBlockSize * width), 0.0f);
+
+    // OctaveDivider's smoothing filter (first-order low-pass at 300Hz)
+    const float n = std::tan(std::numbers::pi_v<float> * static_cast<float>(300.0 / sampleRate));
+    const float a0Inverse = 1.0f / (n + 1.0f);
+    smoothingB0 = n * a0Inverse;
+    smoothingA1 = (n - 1.0f) * a0Inverse;
+
+    for (int instance = 0; instance < numGroups * width; ++instance)
+        setParameters(instance, {});
+
+    reset();
+}
+
+void BatchedReeseEngine::reset()
+{
+    for (auto& group : groups)
+        resetGroup(group);
+}
+
+void BatchedReeseEngine::resetGroup(Group& group)
+{
+    for (int lane = 0; lane < width; ++lane)
+    {
+        group.comparator[lane] = 0.0f;
+        group.flipFlop[lane] = -1.0f;
+        group.previousInput[lane] = 0.0f;
+        group.pendingSquare[lane] = -1.0f;
+        group.smoothing[lane] = 0.0f;
+        group.ringPhase[lane] = 0.0f;
+
+        for (int path = 0; path < 3; ++path)
+            group.ic1[path][lane] = group.ic2[path][lane] = 0.0f;
+
+        for (auto& stage : group.pink)
+            stage[lane] = 0.0f;
+    }
+}
+
+void BatchedReeseEngine::setParameters(int instance, const InstanceParameters& parameters)
+{
+    // Padding lanes of the last group are set too (they keep the defaults)
+    assert(instance >= 0 && instance < static_cast<int>(groups.size()) * width);
+
+    auto& group = groups[static_cast<size_t>(instance / width)];
+    const int lane = instance % width;
+
+    // StateVariableFilter::updateCoefficients, in the same float arithmetic
+    const float cutoff = std::clamp(parameters.cutoff, 20.0f, 20000.0f);
+    const float resonance = std::clamp(parameters.resonance, 0.0f, 0.95f);
+    const float wd = 2.0f * std::numbers::pi_v<float> * cutoff;
+    const float T = 1.0f / static_cast<float>(sampleRate);
+    const float wa = (2.0f / T) * std::tan(wd * T / 2.0f);
+    const float g = wa * T / 2.0f;
+    const float k = 1.0f / (0.5f + (resonance * 19.5f));
+
+    group.filterG[lane] = g;
+    group.filterK[lane] = k;
+    group.filterD[lane] = 1.0f / (1.0f + g * k + g * g);
+
+    group.ringIncrement[lane] = std::clamp(parameters.ringRate, 0.5f, 10.0f) / static_cast<float>(sampleRate);
+    group.ringDepth[lane] = std::clamp(parameters.ringDepth, 0.0f, 1.0f);
+    group.drive[lane] = std::clamp(parameters.drive, 0.0f, 2.0f);
+
+    const auto mix = ReeseChain::MixLevels::fromCharacter(parameters.character);
+    group.mixClean[lane] = mix.clean;
+    group.mixOctave[lane] = mix.subOctave * parameters.octaveBlend;
+    group.mixRing[lane] = mix.ringMod;
+    group.mixRingOctave[lane] = mix.ringModOctave;
+
+    // NoiseGenerator: -60dB to -40dB; volume as juce::Decibels::decibelsToGain
+    const float noiseAmount = std::clamp(parameters.noiseAmount, 0.0f, 1.0f);
+    group.noiseGain[lane] = std::pow(10.0f, (-60.0f + (noiseAmount * 20.0f)) / 20.0f);
+    group.volume[lane] = parameters.volume > -100.0f ? std::pow(10.0f, parameters.volume * 0.05f) : 0.0f;
+}
+
+//==============================================================================
+void BatchedReeseEngine::process(const float* const* inputs, float* const* outputs, int numSamples)
+{
+    for (size_t groupIndex = 0; groupIndex < groups.size(); ++groupIndex)
+    {
+        const int firstInstance = static_cast<int>(groupIndex) * width;
+        const int numLanes = std::min(width, numInstances - firstInstance);
+
+        for (int offset = 0; offset < numSamples; offset += subBlockSize)
+        {
+            const int length = std::min(subBlockSize, numSamples - offset);
+
+            // Transpose the group's inputs to [sample][lane] and draw each lane's white noise
+            for (int lane = 0; lane < width; ++lane)
+            {
+                if (lane >= numLanes)
+                {
+                    for (int i = 0; i < length; ++i)
+                        laneInput[static_cast<size_t>(i * width + lane)] = laneNoise[static_cast<size_t>(i * width + lane)] = 0.0f;
+
+                    continue;
+                }
+
+                const float* input = inputs[firstInstance + lane] + offset;
+                auto& noiseSource = noiseSources[static_cast<size_t>(firstInstance + lane)];
+
+                for (int i = 0; i < length; ++i)
+                {
+                    laneInput[static_cast<size_t>(i * width + lane)] = input[i];
+                    laneNoise[static_cast<size_t>(i * width + lane)] = noiseDistribution(noiseSource);
+                }
+            }
+
+            processGroup(groups[groupIndex], length);
+
+            for (int lane = 0; lane < numLanes; ++lane)
+            {
+                float* output = outputs[firstInstance + lane] + offset;
+
+                for (int i = 0; i < length; ++i)
+                    output[i] = laneOutput[static_cast<size_t>(i * width + lane)];
+            }
+        }
+    }
+}
+
+void BatchedReeseEngine::processGroup(Group& group, int numSamples)
+{
+    const auto zero = Vec::broadcast(0.0f);
+    const auto one = Vec::broadcast(1.0f);
+    const auto trigger = Vec::broadcast(octaveTrigger);
+    const auto smoothingB0Vec = Vec::broadcast(smoothingB0);
+    const auto smoothingA1Vec = Vec::broadcast(smoothingA1);
+
+    // Coefficients
+    const auto g = Vec::load(group.filterG);
+    const auto k = Vec::load(group.filterK);
+    const auto d = Vec::load(group.filterD);
+    const auto ringIncrement = Vec::load(group.ringIncrement);
+    const auto ringDepth = Vec::load(group.ringDepth);
+    const auto drive = Vec::load(group.drive);
+    const auto mixClean = Vec::load(group.mixClean);
+    const auto mixOctave = Vec::load(group.mixOctave);
+    const auto mixRing = Vec::load(group.mixRing);
+    const auto mixRingOctave = Vec::load(group.mixRingOctave);
+    const auto noiseGain = Vec::load(group.noiseGain) * Vec::broadcast(0.11f);   // Pink normalization
+    const auto volume = Vec::load(group.volume);
+
+    // State, kept in registers for the sub-block
+    auto comparator = Vec::load(group.comparator);
+    auto flipFlop = Vec::load(group.flipFlop);
+    auto previousInput = Vec::load(group.previousInput);
+    auto pendingSquare = Vec::load(group.pendingSquare);
+    auto smoothing = Vec::load(group.smoothing);
+    auto ringPhase = Vec::load(group.ringPhase);
+
+    Vec ic1[3], ic2[3], pink[7];
+    for (int path = 0; path < 3; ++path)
+    {
+        ic1[path] = Vec::load(group.ic1[path]);
+        ic2[path] = Vec::load(group.ic2[path]);
+    }
+
+    for (int stage = 0; stage < 7; ++stage)
+        pink[stage] = Vec::load(group.pink[stage]);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto input = Vec::load(laneInput.data() + i * width);
+
+        // Octave divider: hysteresis comparator, flip-flop toggles on rising edges,
+        // PolyBLEP at the interpolated crossing (lanes without an edge discard it), RC smoothing
+        const auto state = Vec::select(Vec::greaterThan(input, trigger), one,
+                                       Vec::select(Vec::lessThan(input, zero - trigger), zero, comparator));
+        const auto risingEdge = state * (one - comparator);
+        const auto edge = Vec::greaterThan(risingEdge, zero);
+        comparator = state;
+        flipFlop = flipFlop * (one - risingEdge - risingEdge);
+
+        const auto elapsed = Vec::min(Vec::max((input - trigger) / (input - previousInput), zero), one);
+        const auto remaining = one - elapsed;
+        const auto square = pendingSquare + Vec::select(edge, flipFlop * elapsed * elapsed, zero);
+        pendingSquare = flipFlop - Vec::select(edge, flipFlop * remaining * remaining, zero);
+        previousInput = input;
+
+        auto octave = smoothingB0Vec * square + smoothing;
+        smoothing = smoothingB0Vec * square - smoothingA1Vec * octave;
+        octave = svfLowPass(octave, g, k, d, ic1[0], ic2[0]);
+
+        // Ring mod path, then the combined path (the LFO advances once for each)
+        const auto ring = svfLowPass(input * ringGain(ringPhase, ringDepth), g, k, d, ic1[1], ic2[1]);
+        ringPhase = advancePhase(ringPhase, ringIncrement);
+
+        const auto combined = svfLowPass(octave * ringGain(ringPhase, ringDepth), g, k, d, ic1[2], ic2[2]);
+        ringPhase = advancePhase(ringPhase, ringIncrement);
+
+        // Mix, saturate
+        const auto mixed = input * mixClean + octave * mixOctave + ring * mixRing + combined * mixRingOctave;
+        const auto shaped = shape(mixed, drive);
+
+        // Paul Kellett's pink noise from this lane's white noise
+        const auto white = Vec::load(laneNoise.data() + i * width);
+        pink[0] = Vec::broadcast(0.99886f) * pink[0] + white * Vec::broadcast(0.0555179f);
+        pink[1] = Vec::broadcast(0.99332f) * pink[1] + white * Vec::broadcast(0.0750759f);
+        pink[2] = Vec::broadcast(0.96900f) * pink[2] + white * Vec::broadcast(0.1538520f);
+        pink[3] = Vec::broadcast(0.86650f) * pink[3] + white * Vec::broadcast(0.3104856f);
+        pink[4] = Vec::broadcast(0.55000f) * pink[4] + white * Vec::broadcast(0.5329522f);
+        pink[5] = Vec::broadcast(-0.7616f) * pink[5] - white * Vec::broadcast(0.0168980f);
+
+        const auto noise = pink[0] + pink[1] + pink[2] + pink[3] + pink[4] + pink[5] + pink[6]
+                         + white * Vec::broadcast(0.5362f);
+        pink[6] = white * Vec::broadcast(0.115926f);
+
+        // Volume and the soft knee output stage
+        softKnee((shaped + noise * noiseGain) * volume).store(laneOutput.data() + i * width);
+    }
+
+    comparator.store(group.comparator);
+    flipFlop.store(group.flipFlop);
+    previousInput.store(group.previousInput);
+    pendingSquare.store(group.pendingSquare);
+    smoothing.store(group.smoothing);
+    ringPhase.store(group.ringPhase);
+
+    for (int path = 0; path < 3; ++path)
+    {
+        ic1[path].store(group.ic1[path]);
+        ic2[path].store(group.ic2[path]);
+    }
+
+    for (int stage = 0; stage < 7; ++stage)
+        pink[stage].store(group.pink[stage]);
+}
@@ -0,0 +1,175 @@
+#include "CabinetImpulse.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace
+{
+    constexpr double pi = std::numbers::pi;
+
+    // Resampler kernel: zero crossings each side, Kaiser alpha, passband edge (of the lower Nyquist)
+    constexpr int resamplerZeroCrossings = 32;
+    constexpr double resamplerAlpha = 10.0;
+    constexpr double resamplerPassband = 0.97;
+
+    // Fade applied when the IR is longer than maxLengthSeconds
+    constexpr double truncationFadeSeconds = 0.005;
+
+    // The response is normalized to its peak over the audible band
+    constexpr double normalizeMinHz = 20.0;
+    constexpr double normalizeMaxHz = 20000.0;
+
+    // Modified Bessel function of the first kind, order 0 (series)
+    double besselI0(double x)
+    {
+        double sum = 1.0, term = 1.0;
+
+        for (int k = 1; k < 50 && term > sum * 1.0e-12; ++k)
+        {
+            const double factor = x / (2.0 * k);
+            term *= factor * factor;
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    // Peak magnitude of the response between normalizeMinHz and normalizeMaxHz
+    float peakMagnitude(const std::vector<float>& taps, double sampleRate)
+    {
+        int order = 12;   // At least 4096 points, for resolution at short IRs
+        while ((1 << order) < 2 * static_cast<int>(taps.size()))
+            ++order;
+
+        const RealFFT analysis(order);
+        const auto size = static_cast<size_t>(analysis.getSize());
+
+        std::vector<float> padded(size, 0.0f), scratch(size);
+        std::vector<float> real(static_cast<size_t>(analysis.getNumBins())), imag(real.size());
+        std::copy(taps.begin(), taps.end(), padded.begin());
+        analysis.forward(padded.data(), real.data(), imag.data(), scratch.data());
+
+        const double binHz = sampleRate / static_cast<double>(size);
+        float peak = 0.0f;
+
+        for (size_t bin = 0; bin < real.size(); ++bin)
+        {
+            const double frequency = static_cast<double>(bin) * binHz;
+
+            if (frequency >= normalizeMinHz && frequency <= normalizeMaxHz)
+                peak = std::max(peak, std::sqrt(real[bin] * real[bin] + imag[bin] * imag[bin]));
+        }
+
+        return peak;
+    }
+}
+
+//==============================================================================
+std::vector<float> CabinetImpulse::resample(const float* samples, int numSamples, double sourceRate, double targetRate)
+{
+    if (numSamples <= 0)
+        return {};
+
+    const double ratio = targetRate / sourceRate;
+
+    if (std::abs(ratio - 1.0) < 1.0e-9)
+        return std::vector<float>(samples, samples + numSamples);
+
+    // Cutoff (in cycles per source sample x 2) below the lower of the two Nyquists
+    const double bandwidth = resamplerPassband * std::min(1.0, ratio);
+    const double halfWidth = resamplerZeroCrossings / bandwidth;   // Source samples each side
+    const double windowNormalization = 1.0 / besselI0(resamplerAlpha);
+
+    // Rounded down first: an exact ratio must not gain a sample to rounding error
+    const auto numOutput = static_cast<int>(std::ceil(numSamples * ratio - 1.0e-6));
+    std::vector<float> output(static_cast<size_t>(numOutput));
+
+    for (int n = 0; n < numOutput; ++n)
+    {
+        const double position = n / ratio;
+        const int first = std::max(0, static_cast<int>(std::ceil(position - halfWidth)));
+        const int last = std::min(numSamples - 1, static_cast<int>(std::floor(position + halfWidth)));
+        double sum = 0.0;
+
+        for (int k = first; k <= last; ++k)
+        {
+            const double distance = position - k;
+            const double x = bandwidth * distance;
+            const double sinc = std::abs(x) < 1.0e-12 ? 1.0 : std::sin(pi * x) / (pi * x);
+            const double u = distance / halfWidth;
+            const double window = besselI0(resamplerAlpha * std::sqrt(std::max(0.0, 1.0 - u * u))) * windowNormalization;
+
+            sum += samples[k] * bandwidth * sinc * window;
+        }
+
+        output[static_cast<size_t>(n)] = static_cast<float>(sum);
+    }
+
+    return output;
+}
+
+//==============================================================================
+CabinetImpulse::CabinetImpulse(const float* samples, int numSamples, double sourceRate, double newSampleRate)
+    : sampleRate(newSampleRate)
+{
+    auto taps = resample(samples, numSamples, sourceRate, sampleRate);
+
+    // Drop the silent tail, then cap the length
+    float peak = 0.0f;
+    for (const float tap : taps)
+        peak = std::max(peak, std::abs(tap));
+
+    const float threshold = peak * std::pow(10.0f, trimThresholdDb / 20.0f);
+    auto last = taps.size();
+    while (last > 0 && std::abs(taps[last - 1]) <= threshold)
+        --last;
+
+    const auto maxLength = static_cast<size_t>(maxLengthSeconds * sampleRate);
+
+    if (last > maxLength)
+    {
+        last = maxLength;
+        const auto fadeLength = std::min(last, static_cast<size_t>(truncationFadeSeconds * sampleRate));
+
+        for (size_t i = 0; i < fadeLength; ++i)
+            taps[last - 1 - i] *= static_cast<float>(0.5 - 0.5 * std::cos(pi * static_cast<double>(i) / static_cast<double>(fadeLength)));
+    }
+
+    taps.resize(last);
+
+    // Silent or empty files pass the signal through unchanged
+    const float responsePeak = taps.empty() ? 0.0f : peakMagnitude(taps, sampleRate);
+
+    if (responsePeak <= 0.0f)
+        taps.assign(1, 1.0f);
+    else
+        for (auto& tap : taps)
+            tap /= responsePeak;
+
+    length = static_cast<int>(taps.size());
+
+    // Head: the first block, reversed for the direct-form convolution
+    reversedHead.assign(blockSize, 0.0f);
+    for (int t = 0; t < std::min(length, blockSize); ++t)
+        reversedHead[static_cast<size_t>(blockSize - 1 - t)] = taps[static_cast<size_t>(t)];
+
+    // Tail: one spectrum per further block, scaled by the inverse transform's gain
+    numPartitions = std::max(0, (length - 1) / blockSize);
+    partitionReal.assign(static_cast<size_t>(numPartitions * binStride), 0.0f);
+    partitionImag.assign(partitionReal.size(), 0.0f);
+
+    std::vector<float> frame(fftSize), scratch(fftSize);
+    const float scale = 2.0f / static_cast<float>(fftSize);
+
+    for (int partition = 0; partition < numPartitions; ++partition)
+    {
+        std::fill(frame.begin(), frame.end(), 0.0f);
+
+        const int start = blockSize * (partition + 1);
+        for (int t = 0; t < blockSize && start + t < length; ++t)
+            frame[static_cast<size_t>(t)] = taps[static_cast<size_t>(start + t)] * scale;
+
+        fft.forward(frame.data(), partitionReal.data() + partition * binStride,
+                    partitionImag.data() + partition * binStride, scratch.data());
+    }
+}
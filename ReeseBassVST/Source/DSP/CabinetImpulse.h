@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+#include "RealFFT.h"
+
+/**
+ * CabinetImpulse - Partitioned Cabinet Impulse Response, Ready to Convolve
+ *
+ * Immutable: built once per (IR file, sample rate) off the audio thread and
+ * shared by every PartitionedConvolver (every channel of every instance)
+ * using that file. Each convolver then only keeps its own input history.
+ *
+ * Building conforms the raw IR first:
+ * 1. Resampled to the processing rate with a Kaiser-windowed sinc (a file
+ *    recorded at 44.1kHz in a 96kHz session keeps its response)
+ * 2. Trailing samples below -80dB of the peak are dropped, the rest is
+ *    truncated to maxLengthSeconds with a short fade-out
+ * 3. Scaled so the loudest frequency of the response (20Hz-20kHz) sits at
+ *    0dB: cabinets only cut, whatever their recording level or sample rate
+ *
+ * The response is then split for PartitionedConvolver (uniform partitions
+ * of blockSize samples):
+ *
+ *   head:  taps 0 .. blockSize-1, convolved directly (zero latency)
+ *   tail:  partition p covers taps blockSize * (p + 1) .. blockSize * (p + 2) - 1,
+ *          stored as the spectrum of the partition zero-padded to fftSize
+ *
+ * Spectra are scaled by the RealFFT round-trip gain, so the convolver uses
+ * the inverse transform's output as is.
+ */
+class CabinetImpulse
+{
+public:
+    static constexpr int blockSize = 64;             // Partition size: the processor's chunk size
+    static constexpr int fftOrder = 7;
+    static constexpr int fftSize = 1 << fftOrder;   // Two blocks (overlap-save)
+    static constexpr int numBins = fftSize / 2 + 1;
+    static constexpr int binStride = 72;             // numBins padded to whole SIMD vectors
+    static constexpr double maxLengthSeconds = 0.25;
+    static constexpr float trimThresholdDb = -80.0f;
+
+    /**
+     * Conform and partition an impulse response (allocates: not on the audio thread)
+     * @param samples Mono IR at sourceRate
+     * @param numSamples IR length
+     * @param sourceRate Sample rate of the IR in Hz
+     * @param sampleRate Processing sample rate in Hz
+     */
+    CabinetImpulse(const float* samples, int numSamples, double sourceRate, double sampleRate);
+
+    /**
+     * Band-limited resampling of a whole signal (Kaiser-windowed sinc)
+     */
+    static std::vector<float> resample(const float* samples, int numSamples, double sourceRate, double targetRate);
+
+    double getSampleRate() const noexcept { return sampleRate; }
+
+    // Length after conforming, in samples at getSampleRate()
+    int getLength() const noexcept { return length; }
+
+    int getNumPartitions() const noexcept { return numPartitions; }
+
+    // Head taps in reverse order: head[blockSize - 1 - t] is tap t
+    const float* getReversedHead() const noexcept { return reversedHead.data(); }
+
+    // Spectrum of tail partition p (binStride floats each, zero past numBins)
+    const float* getPartitionReal(int partition) const noexcept { return partitionReal.data() + partition * binStride; }
+    const float* getPartitionImag(int partition) const noexcept { return partitionImag.data() + partition * binStride; }
+
+    const RealFFT& getFFT() const noexcept { return fft; }
+
+private:
+    double sampleRate;
+    int length = 0;
+    int numPartitions = 0;
+    RealFFT fft { fftOrder };
+    std::vector<float> reversedHead;
+    std::vector<float> partitionReal;
+    std::vector<float> partitionImag;
+};
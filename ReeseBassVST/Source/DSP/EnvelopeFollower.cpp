@@ -0,0 +1,96 @@
+#include "EnvelopeFollower.h"
+#include "SimdFloat.h"
+
+EnvelopeFollower::EnvelopeFollower()
+{
+}
+
+void EnvelopeFollower::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+    reset();
+}
+
+void EnvelopeFollower::reset()
+{
+    envelope = 0.0f;
+}
+
+void EnvelopeFollower::setAttack(float ms)
+{
+    attackMs = std::clamp(ms, 0.01f, 1000.0f);
+}
+
+void EnvelopeFollower::setRelease(float ms)
+{
+    releaseMs = std::clamp(ms, 1.0f, 5000.0f);
+}
+
+void EnvelopeFollower::setMode(DetectorMode newMode)
+{
+    mode = newMode;
+}
+
+float EnvelopeFollower::process(const float* const* channels, int numChannels, int startSample, int numSamples)
+{
+    if (numSamples <= 0)
+        return envelope;
+
+    const float level = measureLevel(channels, numChannels, startSample, numSamples);
+
+    // Attack when rising, release when falling (one step per block)
+    const float coeff = blockCoefficient(level > envelope ? attackMs : releaseMs, numSamples);
+    envelope = level + coeff * (envelope - level);
+
+    return envelope;
+}
+
+float EnvelopeFollower::measureLevel(const float* const* channels, int numChannels, int startSample, int numSamples) const
+{
+    if (channels == nullptr || numChannels <= 0)
+        return 0.0f;
+
+    const int vectorEnd = numSamples - (numSamples % SimdFloat::width);
+    float level = 0.0f;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const float* data = channels[channel] + startSample;
+        int i = 0;
+
+        if (mode == DetectorMode::PEAK)
+        {
+            auto peak = SimdFloat::broadcast(0.0f);
+            for (; i < vectorEnd; i += SimdFloat::width)
+                peak = SimdFloat::max(peak, SimdFloat::abs(SimdFloat::load(data + i)));
+
+            level = std::max(level, maxElement(peak));
+            for (; i < numSamples; ++i)
+                level = std::max(level, std::abs(data[i]));
+        }
+        else
+        {
+            auto sum = SimdFloat::broadcast(0.0f);
+            for (; i < vectorEnd; i += SimdFloat::width)
+            {
+                const auto x = SimdFloat::load(data + i);
+                sum += x * x;
+            }
+
+            level += sumElements(sum);
+            for (; i < numSamples; ++i)
+                level += data[i] * data[i];
+        }
+    }
+
+    if (mode == DetectorMode::RMS)
+        level = std::sqrt(level / static_cast<float>(numSamples * numChannels));
+
+    return level;
+}
+
+float EnvelopeFollower::blockCoefficient(float timeMs, int numSamples) const
+{
+    const double timeSamples = static_cast<double>(timeMs) * 0.001 * sampleRate;
+    return static_cast<float>(std::exp(-static_cast<double>(numSamples) / timeSamples));
+}
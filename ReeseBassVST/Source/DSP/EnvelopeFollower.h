@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * EnvelopeFollower - Control-Rate Envelope Detector
+ *
+ * Tracks the level of a (sidechain) signal once per block instead of once
+ * per sample, for ducking and modulation:
+ *
+ * 1. Detector: peak (max |x|) or RMS (sqrt of mean x^2) over the whole block
+ *    and all channels, computed SimdFloat::width samples at a time
+ * 2. Ballistics: one-pole attack/release smoothing applied once per block,
+ *    with the coefficient scaled by the block length:
+ *
+ *      coeff = exp(-blockSize / (time * sampleRate))
+ *      env   = level + coeff * (env - level)     (attack if rising, else release)
+ *
+ * The result is the same time constants as a per-sample follower at a
+ * fraction of the cost; block sizes of 16-64 samples (0.3-1.5ms at 48kHz)
+ * are far below any useful attack time.
+ */
+class EnvelopeFollower
+{
+public:
+    enum class DetectorMode
+    {
+        PEAK,   // Fast transient tracking (kick ducking)
+        RMS     // Average energy (smoother, louder material)
+    };
+
+    EnvelopeFollower();
+
+    /**
+     * Prepare the module for processing
+     * @param sampleRate The sample rate in Hz
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * Analyse one block and update the envelope
+     * @param channels Channel pointers (may be empty: input is treated as silence)
+     * @param numChannels Number of channels to analyse
+     * @param startSample First sample of the block in each channel
+     * @param numSamples Block length
+     * @return Envelope after the block (linear, 0.0 and up)
+     */
+    float process(const float* const* channels, int numChannels, int startSample, int numSamples);
+
+    /**
+     * Set the attack time
+     * @param ms Attack time in milliseconds
+     */
+    void setAttack(float ms);
+
+    /**
+     * Set the release time
+     * @param ms Release time in milliseconds
+     */
+    void setRelease(float ms);
+
+    /**
+     * Set the level detector
+     * @param mode Peak or RMS
+     */
+    void setMode(DetectorMode mode);
+
+    /**
+     * Current envelope value (linear)
+     */
+    float getEnvelope() const { return envelope; }
+
+    /**
+     * Reset internal state
+     */
+    void reset();
+
+private:
+    // Sample rate
+    double sampleRate = 44100.0;
+
+    // Parameters
+    float attackMs = 5.0f;
+    float releaseMs = 150.0f;
+    DetectorMode mode = DetectorMode::PEAK;
+
+    // State
+    float envelope = 0.0f;
+
+    // Detector level of one block
+    float measureLevel(const float* const* channels, int numChannels, int startSample, int numSamples) const;
+
+    // One-pole coefficient for a time constant over numSamples
+    float blockCoefficient(float timeMs, int numSamples) const;
+};
@@ -0,0 +1,158 @@
+#include "LadderFilter.h"
+
+LadderFilter::LadderFilter()
+{
+}
+
+void LadderFilter::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+
+    if (prewarpTable == nullptr)
+    {
+        prewarpTable = SharedTables::acquire(SharedTables::Type::TAN_PREWARP);
+        tanhTable = SharedTables::acquire(SharedTables::Type::TANH);
+    }
+
+    needsUpdate = true;   // The sample rate changed
+    reset();
+    updateCoefficients();
+}
+
+void LadderFilter::reset()
+{
+    state.fill(0.0f);
+    operatingPoint.fill(0.0f);
+    previousPoint.fill(0.0f);
+}
+
+bool LadderFilter::hasStateOf(const LadderFilter& other, float tolerance) const noexcept
+{
+    for (int i = 0; i < numStages; ++i)
+        if (std::abs(state[static_cast<size_t>(i)] - other.state[static_cast<size_t>(i)]) > tolerance)
+            return false;
+
+    return true;
+}
+
+void LadderFilter::setCutoff(float hz)
+{
+    hz = std::clamp(hz, 20.0f, 20000.0f);
+
+    if (std::abs(cutoffFreq - hz) > 0.01f)
+    {
+        cutoffFreq = hz;
+        needsUpdate = true;
+    }
+}
+
+void LadderFilter::setResonance(float res)
+{
+    res = std::clamp(res, 0.0f, 0.95f);
+
+    if (std::abs(resonance - res) > 0.001f)
+    {
+        resonance = res;
+        needsUpdate = true;
+    }
+}
+
+void LadderFilter::setDrive(float drv)
+{
+    drive = std::clamp(drv, 0.0f, 2.0f);
+}
+
+void LadderFilter::updateCoefficients()
+{
+    if (!needsUpdate)
+        return;
+
+    // Bilinear transform pre-warping, as StateVariableFilter
+    g = prewarpTable->lookup(cutoffFreq / static_cast<float>(sampleRate));
+
+    // Self-oscillation at k = 4
+    k = resonance * 4.0f;
+
+    needsUpdate = false;
+}
+
+float LadderFilter::tanhSlope(float v) const
+{
+    // tanh(v) / v -> 1 - v^2 / 3 near zero, where the division loses precision
+    if (std::abs(v) < 1.0e-3f)
+        return 1.0f - v * v * (1.0f / 3.0f);
+
+    return tanhTable->lookupOdd(v) / v;
+}
+
+float LadderFilter::processSample(float input)
+{
+    // Update coefficients if needed
+    if (needsUpdate)
+        updateCoefficients();
+
+    const float u = input * drive;
+
+    std::array<float, numStages + 1> slope;
+    std::array<float, numStages + 1> solution;
+
+    // First guess: the previous solution extrapolated linearly from the one before
+    for (size_t i = 0; i <= numStages; ++i)
+    {
+        const float previous = operatingPoint[i];
+        operatingPoint[i] = 2.0f * previous - previousPoint[i];
+        previousPoint[i] = previous;
+    }
+
+    for (int pass = 0; pass <= maxRefinements; ++pass)
+    {
+        // Linearize every tanh around the current operating points
+        for (size_t i = 0; i <= numStages; ++i)
+            slope[i] = tanhSlope(operatingPoint[i]);
+
+        // Linear ZDF ladder: each stage's output as a * x1 + b, composed stage by stage
+        //   y_i = (s_i + g * slope_{i-1} * y_{i-1}) / (1 + g * slope_i)
+        std::array<float, numStages> inputGain;   // g * slope_{i-1} / (1 + g * slope_i)
+        std::array<float, numStages> stateGain;   // 1 / (1 + g * slope_i)
+
+        float a = 1.0f;
+        float b = 0.0f;
+
+        for (size_t i = 0; i < numStages; ++i)
+        {
+            stateGain[i] = 1.0f / (1.0f + g * slope[i + 1]);
+            inputGain[i] = g * slope[i] * stateGain[i];
+            a *= inputGain[i];
+            b = state[i] * stateGain[i] + inputGain[i] * b;
+        }
+
+        // Close the feedback loop: x1 = u - k * (a * x1 + b)
+        solution[0] = (u - k * b) / (1.0f + k * a);
+
+        for (size_t i = 0; i < numStages; ++i)
+            solution[i + 1] = state[i] * stateGain[i] + inputGain[i] * solution[i];
+
+        // Converged: the solution is where every tanh was linearized (the first stage's
+        // input carries the raw signal, so it is the last to settle)
+        float largestMove = 0.0f;
+        for (size_t i = 0; i <= numStages; ++i)
+            largestMove = std::max(largestMove, std::abs(solution[i] - operatingPoint[i]));
+
+        operatingPoint = solution;
+
+        if (largestMove < refinementTolerance)
+            break;
+    }
+
+    // Trapezoidal state update: s' = 2y - s
+    for (size_t i = 0; i < numStages; ++i)
+    {
+        state[i] = 2.0f * solution[i + 1] - state[i];
+
+        // Prevent denormals (very small numbers that cause CPU issues)
+        if (std::abs(state[i]) < 1e-10f) state[i] = 0.0f;
+    }
+
+    // Restore the passband gain lost to the feedback
+    return solution[numStages] * (1.0f + k);
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include "SharedTables.h"
+
+/**
+ * LadderFilter - Nonlinear Zero-Delay-Feedback Transistor Ladder
+ *
+ * 4-pole (24dB/octave) low-pass in the style of the Moog ladder: four
+ * trapezoidal one-pole stages with a tanh on every stage's input and state,
+ * and global negative feedback k * y4 around them:
+ *
+ *   stage i:  y_i = s_i + g * (tanh(x_i) - tanh(y_i)),   x_1 = u - k * y4
+ *
+ * Solved without a unit delay in the feedback loop, so the cutoff and
+ * resonance track like the analog circuit up to Nyquist. Solving the five
+ * coupled tanh equations exactly (Newton on the full system) costs several
+ * times the SVF, so each nonlinearity is linearized around an operating
+ * point instead, tanh(v) ~= v * tanh(v0) / v0, which turns the system into
+ * a linear ZDF ladder solved in closed form:
+ *
+ * 1. Operating points start at the previous two samples' solutions,
+ *    extrapolated linearly (audio moves smoothly from sample to sample, so
+ *    this alone is within about -50dB of the converged output)
+ * 2. Solve the linear ladder, re-linearize around the result, and repeat up
+ *    to maxRefinements times, stopping early once no operating point moves
+ *    more than refinementTolerance. One refinement is typically below -110dB
+ * 3. Update the trapezoidal states from the final solution
+ *
+ * Typically 1.7-2 solves per sample: about 8x the cost of a StateVariableFilter,
+ * 2.6x for a whole ReeseChain (the `filters` benchmark).
+ *
+ * The slopes tanh(v)/v are always in (0, 1], so every solve is a stable
+ * linear filter whatever the signal level. Self-oscillation starts at k = 4;
+ * resonance 0-0.95 maps to k = 0-3.8. The passband gain of a ladder drops to
+ * 1 / (1 + k) with resonance, so the output is scaled back up by (1 + k).
+ */
+class LadderFilter
+{
+public:
+    static constexpr int maxRefinements = 2;
+    static constexpr float refinementTolerance = 1.0e-5f;
+
+    LadderFilter();
+
+    /**
+     * Prepare the module for processing
+     * @param sampleRate The sample rate in Hz
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * Process a single sample
+     * @param input Input audio sample
+     * @return Low-pass output
+     */
+    float processSample(float input);
+
+    /**
+     * Set the cutoff frequency
+     * @param hz Frequency in Hz (20-20000Hz)
+     */
+    void setCutoff(float hz);
+
+    /**
+     * Set the resonance
+     * @param resonance 0.0-0.95 (0% to 95%)
+     */
+    void setResonance(float resonance);
+
+    /**
+     * Set input drive (gain into the first stage's tanh)
+     * @param drive 0.0-2.0 (0% to 200%)
+     */
+    void setDrive(float drive);
+
+    /**
+     * Reset internal state
+     */
+    void reset();
+
+    /**
+     * Stage states within tolerance of another filter's
+     */
+    bool hasStateOf(const LadderFilter& other, float tolerance) const noexcept;
+
+private:
+    static constexpr int numStages = 4;
+
+    // Sample rate
+    double sampleRate = 44100.0;
+
+    // Trapezoidal integrator state of each stage
+    std::array<float, numStages> state {};
+
+    // Operating points: the last solution of the first stage's input
+    // (u - k * y4) and of each stage's output
+    std::array<float, numStages + 1> operatingPoint {};
+    std::array<float, numStages + 1> previousPoint {};   // One sample older
+
+    // Filter parameters
+    float cutoffFreq = 500.0f;    // Cutoff frequency in Hz
+    float resonance = 0.5f;       // Resonance (0.0-0.95)
+    float drive = 1.0f;           // Input drive (0.0-2.0)
+
+    // Pre-calculated coefficients
+    float g = 0.0f;  // Cutoff coefficient, tan(pi * fc / fs)
+    float k = 0.0f;  // Feedback gain
+
+    // Coefficient update flag
+    bool needsUpdate = true;
+
+    // Shared tables (acquired in the first prepare())
+    SharedTables::Handle prewarpTable;
+    SharedTables::Handle tanhTable;
+
+    /**
+     * Update filter coefficients when parameters change
+     */
+    void updateCoefficients();
+
+    /**
+     * tanh(v) / v, the slope of the line through the origin and (v, tanh(v))
+     */
+    float tanhSlope(float v) const;
+};
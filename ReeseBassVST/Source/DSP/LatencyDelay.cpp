@@ -0,0 +1,61 @@
+#include "LatencyDelay.h"
+#include <algorithm>
+
+LatencyDelay::LatencyDelay()
+{
+}
+
+void LatencyDelay::prepare(int maxDelay, int maxBlockSize)
+{
+    maxDelaySamples = std::max(0, maxDelay);
+
+    // Power of two, so positions wrap with a mask
+    int size = 1;
+    while (size < maxDelaySamples + std::max(1, maxBlockSize))
+        size *= 2;
+
+    for (auto& line : lines)
+        line.assign(static_cast<size_t>(size), 0.0f);
+
+    mask = size - 1;
+    writePosition = 0;
+}
+
+void LatencyDelay::reset()
+{
+    for (auto& line : lines)
+        std::fill(line.begin(), line.end(), 0.0f);
+
+    writePosition = 0;
+}
+
+void LatencyDelay::write(const float* const* channels, int numChannels, int numSamples)
+{
+    numChannels = std::min(numChannels, maxChannels);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto& line = lines[static_cast<size_t>(channel)];
+
+        for (int i = 0; i < numSamples; ++i)
+            line[static_cast<size_t>((writePosition + i) & mask)] = channels[channel][i];
+    }
+
+    writePosition = (writePosition + numSamples) & mask;
+}
+
+void LatencyDelay::read(float* const* destination, int numChannels, int numSamples, int delay) const
+{
+    numChannels = std::min(numChannels, maxChannels);
+
+    // The block started numSamples before the write position
+    const int start = writePosition - numSamples - std::clamp(delay, 0, maxDelaySamples);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const auto& line = lines[static_cast<size_t>(channel)];
+
+        for (int i = 0; i < numSamples; ++i)
+            destination[channel][i] = line[static_cast<size_t>((start + i) & mask)];
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+/**
+ * LatencyDelay - Dry Signal Aligned with the Processed Signal
+ *
+ * Multichannel ring buffer that delays the unprocessed input by the
+ * plugin's reported latency (oversampling filters plus the true-peak
+ * lookahead), so a bypass crossfade mixes two signals that line up in time.
+ *
+ * Every block is written before it is read back: write() stores the input,
+ * read() returns the same block delayed by any amount up to maxDelay. The
+ * buffer is sized in prepare() for maxDelay plus the longest block, so
+ * processing never allocates. Reading into the buffer that was just
+ * written delays it in place.
+ */
+class LatencyDelay
+{
+public:
+    static constexpr int maxChannels = 2;
+
+    LatencyDelay();
+
+    /**
+     * Prepare the module for processing (allocates the ring buffers)
+     * @param maxDelay Longest delay in samples
+     * @param maxBlockSize Longest block passed to write()
+     */
+    void prepare(int maxDelay, int maxBlockSize);
+
+    /**
+     * Store one block of input (call once per block, before read())
+     * @param channels Channel pointers
+     * @param numChannels Number of channels (up to maxChannels)
+     * @param numSamples Block length (up to maxBlockSize)
+     */
+    void write(const float* const* channels, int numChannels, int numSamples);
+
+    /**
+     * The block last written, delayed
+     * @param destination Channel pointers (may be the ones just written)
+     * @param numChannels Number of channels (up to maxChannels)
+     * @param numSamples Length of the block last written
+     * @param delay Delay in samples (clamped to maxDelay)
+     */
+    void read(float* const* destination, int numChannels, int numSamples, int delay) const;
+
+    /**
+     * Clear the delay lines
+     */
+    void reset();
+
+private:
+    std::array<std::vector<float>, maxChannels> lines;
+    int mask = 0;
+    int maxDelaySamples = 0;
+    int writePosition = 0;   // Where the next block starts
+};
@@ -0,0 +1,156 @@
+#include "LinkwitzRileyCrossover.h"
+#include <numbers>
+
+namespace
+{
+    // Butterworth damping (Q = 0.7071); two cascaded sections give LR4
+    constexpr float butterworthK = 1.41421356f;
+}
+
+LinkwitzRileyCrossover::LinkwitzRileyCrossover()
+{
+}
+
+void LinkwitzRileyCrossover::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+    needsUpdate = true;
+    updateCoefficients();
+    reset();
+}
+
+void LinkwitzRileyCrossover::reset()
+{
+    stageA.reset();
+    stageB.reset();
+    stageC.reset();
+    stageD.reset();
+}
+
+void LinkwitzRileyCrossover::setCrossoverFrequencies(float lowHz, float highHz)
+{
+    lowHz = std::clamp(lowHz, 20.0f, 20000.0f);
+    highHz = std::clamp(highHz, lowHz * 1.5f, 20000.0f);   // Keep the bands ordered
+
+    if (std::abs(lowFrequency - lowHz) > 0.01f || std::abs(highFrequency - highHz) > 0.01f)
+    {
+        lowFrequency = lowHz;
+        highFrequency = highHz;
+        needsUpdate = true;
+    }
+}
+
+float LinkwitzRileyCrossover::prewarp(float hz) const
+{
+    // Same bilinear prewarp as StateVariableFilter: g = tan(pi * fc / fs)
+    const float nyquistSafe = std::min(hz, static_cast<float>(sampleRate) * 0.49f);
+    return std::tan(std::numbers::pi_v<float> * nyquistSafe / static_cast<float>(sampleRate));
+}
+
+void LinkwitzRileyCrossover::updateCoefficients()
+{
+    if (!needsUpdate)
+        return;
+
+    const float gLow = prewarp(lowFrequency);
+    const float gHigh = prewarp(highFrequency);
+
+    stageA.setCoefficients(gLow, gLow, butterworthK);
+    stageB.setCoefficients(gLow, gLow, butterworthK);
+    stageC.setCoefficients(gHigh, gHigh, butterworthK);
+    stageD.setCoefficients(gHigh, gHigh, butterworthK);
+
+    needsUpdate = false;
+}
+
+LinkwitzRileyCrossover::BandSplit LinkwitzRileyCrossover::processSample(float left, float right)
+{
+    if (needsUpdate)
+        updateCoefficients();
+
+    alignas(16) float lp[4], hp[4], lanes[4];
+    Vec lowPass, bandPass, highPass;
+
+    // Stage A: first f1 section for both channels
+    lanes[0] = left;
+    lanes[1] = right;
+    lanes[2] = lanes[3] = 0.0f;
+    stageA.tick(Vec::load(lanes), lowPass, bandPass, highPass);
+    lowPass.store(lp);
+    highPass.store(hp);
+
+    // Stage B: second LP2(f1) and HP2(f1) sections -> LR4 low / LR4 high at f1
+    lanes[0] = lp[0];
+    lanes[1] = lp[1];
+    lanes[2] = hp[0];
+    lanes[3] = hp[1];
+    stageB.tick(Vec::load(lanes), lowPass, bandPass, highPass);
+    lowPass.store(lp);
+    highPass.store(hp);
+
+    // Stage C: allpass(f2) on the low band, first f2 section on the rest
+    lanes[0] = lp[0];
+    lanes[1] = lp[1];
+    lanes[2] = hp[2];
+    lanes[3] = hp[3];
+    const Vec stageCInput = Vec::load(lanes);
+    stageC.tick(stageCInput, lowPass, bandPass, highPass);
+
+    BandSplit split;
+    alignas(16) float allPass[4];
+    (stageCInput - Vec::broadcast(2.0f * butterworthK) * bandPass).store(allPass);
+    split.sub[0] = allPass[0];
+    split.sub[1] = allPass[1];
+
+    lowPass.store(lp);
+    highPass.store(hp);
+
+    // Stage D: second LP2(f2) / HP2(f2) sections -> mid and high bands
+    lanes[0] = lp[2];
+    lanes[1] = lp[3];
+    lanes[2] = hp[2];
+    lanes[3] = hp[3];
+    stageD.tick(Vec::load(lanes), lowPass, bandPass, highPass);
+    lowPass.store(lp);
+    highPass.store(hp);
+
+    split.mid[0] = lp[0];
+    split.mid[1] = lp[1];
+    split.high[0] = hp[2];
+    split.high[1] = hp[3];
+
+    return split;
+}
+
+//==============================================================================
+void LinkwitzRileyCrossover::SvfBank::setCoefficients(float gLow, float gHigh, float damping)
+{
+    alignas(16) const float gLanes[4] = { gLow, gLow, gHigh, gHigh };
+    g = Vec::load(gLanes);
+    k = Vec::broadcast(damping);
+
+    alignas(16) float dLanes[4];
+    for (int i = 0; i < 4; ++i)
+        dLanes[i] = 1.0f / (1.0f + gLanes[i] * damping + gLanes[i] * gLanes[i]);
+
+    d = Vec::load(dLanes);
+}
+
+void LinkwitzRileyCrossover::SvfBank::tick(Vec input, Vec& lowPass, Vec& bandPass, Vec& highPass)
+{
+    // Trapezoidal SVF, solved for the high-pass output (Zavalishin):
+    // hp = (x - (k + g) * s1 - s2) / (1 + g*k + g^2)
+    highPass = (input - (k + g) * s1 - s2) * d;
+
+    bandPass = g * highPass + s1;
+    s1 = g * highPass + bandPass;
+
+    lowPass = g * bandPass + s2;
+    s2 = g * bandPass + lowPass;
+}
+
+void LinkwitzRileyCrossover::SvfBank::reset()
+{
+    s1 = Vec::broadcast(0.0f);
+    s2 = Vec::broadcast(0.0f);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include "SimdFloat.h"
+
+/**
+ * LinkwitzRileyCrossover - 3-Band LR4 Crossover (Sub / Mid / High)
+ *
+ * Splits a stereo signal into three bands with 24dB/octave Linkwitz-Riley
+ * slopes that sum back to a flat magnitude response:
+ *
+ *   sub  = AP(f2)  [ LP2(f1) -> LP2(f1) ]     (allpass keeps phase aligned)
+ *   mid  = LP2(f2) -> LP2(f2)  [ HP2(f1) -> HP2(f1) ]
+ *   high = HP2(f2) -> HP2(f2)  [ HP2(f1) -> HP2(f1) ]
+ *
+ *   sub + mid + high = AP(f2) * AP(f1) * input    (allpass: flat magnitude)
+ *
+ * Every section is a linear trapezoidal SVF (same topology and prewarp as
+ * StateVariableFilter) with Butterworth damping k = sqrt(2); the 2nd-order
+ * allpass is x - 2k*bp. Sections that do not depend on each other are packed
+ * into the 4 lanes of one SIMD register, across bands and channels:
+ *
+ *   stage A: [ split(f1) L, split(f1) R,  -,          -          ]
+ *   stage B: [ LP2(f1) L,   LP2(f1) R,    HP2(f1) L,  HP2(f1) R  ]
+ *   stage C: [ AP(f2) L,    AP(f2) R,     split(f2) L, split(f2) R ]
+ *   stage D: [ LP2(f2) L,   LP2(f2) R,    HP2(f2) L,  HP2(f2) R  ]
+ *
+ * so a stereo 3-band split costs four vector SVF ticks per sample frame.
+ */
+class LinkwitzRileyCrossover
+{
+public:
+    /**
+     * One stereo sample frame split into bands
+     */
+    struct BandSplit
+    {
+        float sub[2];
+        float mid[2];
+        float high[2];
+    };
+
+    LinkwitzRileyCrossover();
+
+    /**
+     * Prepare the module for processing
+     * @param sampleRate The sample rate in Hz
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * Set the crossover frequencies
+     * @param lowHz Sub/Mid crossover in Hz
+     * @param highHz Mid/High crossover in Hz (kept above lowHz)
+     */
+    void setCrossoverFrequencies(float lowHz, float highHz);
+
+    /**
+     * Split one stereo sample frame (pass 0 for the right channel when mono)
+     */
+    BandSplit processSample(float left, float right);
+
+    /**
+     * Reset internal state
+     */
+    void reset();
+
+private:
+    using Vec = SimdVector<4>;
+
+    /**
+     * Four independent linear SVF sections, one per lane
+     */
+    struct SvfBank
+    {
+        Vec s1 = Vec::broadcast(0.0f);   // Integrator 1 state
+        Vec s2 = Vec::broadcast(0.0f);   // Integrator 2 state
+        Vec g = Vec::broadcast(0.0f);    // Cutoff coefficient
+        Vec k = Vec::broadcast(0.0f);    // Damping coefficient
+        Vec d = Vec::broadcast(1.0f);    // 1 / (1 + g*k + g*g)
+
+        void setCoefficients(float gLow, float gHigh, float damping);   // Lanes 0-1 / 2-3
+        void tick(Vec input, Vec& lowPass, Vec& bandPass, Vec& highPass);
+        void reset();
+    };
+
+    // Sample rate
+    double sampleRate = 44100.0;
+
+    // Crossover frequencies
+    float lowFrequency = 120.0f;
+    float highFrequency = 2000.0f;
+    bool needsUpdate = true;
+
+    SvfBank stageA, stageB, stageC, stageD;
+
+    void updateCoefficients();
+    float prewarp(float hz) const;
+};
@@ -1,7 +1,7 @@
 #include "NoiseGenerator.h"
 
 NoiseGenerator::NoiseGenerator()
-    : rng(std::random_device{}()),
+    : rng(0x5eed),   // Fixed until seed(): constructing never touches the OS entropy source
       distribution(-1.0f, 1.0f)
 {
 }
@@ -9,6 +9,10 @@ NoiseGenerator::NoiseGenerator()
 void NoiseGenerator::prepare(double newSampleRate)
 {
     sampleRate = newSampleRate;
+
+    if (decibelTable == nullptr)
+        decibelTable = SharedTables::acquire(SharedTables::Type::DECIBELS_TO_GAIN);
+
     reset();
 }
 
@@ -18,9 +22,14 @@ void NoiseGenerator::reset()
     b0 = b1 = b2 = b3 = b4 = b5 = b6 = 0.0f;
 }
 
+void NoiseGenerator::seed(std::uint32_t value)
+{
+    rng.seed(value);
+}
+
 void NoiseGenerator::setAmount(float amount)
 {
-    noiseAmount = juce::jlimit(0.0f, 1.0f, amount);
+    noiseAmount = std::clamp(amount, 0.0f, 1.0f);
 }
 
 void NoiseGenerator::setColor(NoiseColor color)
@@ -96,5 +105,5 @@ float NoiseGenerator::amountToGain(float amount)
     float dB = -60.0f + (amount * 20.0f);
 
     // Convert dB to linear gain
-    return std::pow(10.0f, dB / 20.0f);
+    return decibelTable->lookup(dB);
 }
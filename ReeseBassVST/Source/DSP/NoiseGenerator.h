@@ -1,8 +1,10 @@
 #pragma once
 
-#include <juce_core/juce_core.h>
+#include <algorithm>
 #include <random>
 #include <cmath>
+#include <cstdint>
+#include "SharedTables.h"
 
 /**
  * NoiseGenerator - Analog-Style Noise Generator
@@ -70,6 +72,12 @@ public:
      */
     void reset();
 
+    /**
+     * Reseed the white noise source (until then it uses a fixed seed)
+     * @param value Any value; instances that should decorrelate need different seeds
+     */
+    void seed(std::uint32_t value);
+
 private:
     // Sample rate
     double sampleRate = 44100.0;
@@ -82,6 +90,9 @@ private:
     float noiseAmount = 0.2f;  // 0.0-1.0 (user control)
     NoiseColor currentColor = NoiseColor::PINK;
 
+    // Shared dB-to-gain table (acquired in the first prepare())
+    SharedTables::Handle decibelTable;
+
     // Pink noise filter state (using Paul Kellet's implementation)
     // Pink noise is generated by filtering white noise
     float b0 = 0.0f;
@@ -1,4 +1,6 @@
 #include "OctaveDivider.h"
+#include <algorithm>
+#include <numbers>
 
 OctaveDivider::OctaveDivider()
 {
@@ -17,19 +19,31 @@ void OctaveDivider::reset()
     currentState = false;
     flipFlopState = false;
     flipFlopState2 = false;
+    pendingSquare = -1.0f;
     previousInput = 0.0f;
-    smoothingFilter.reset();
+    smoothingState = 0.0f;
+}
+
+bool OctaveDivider::hasStateOf(const OctaveDivider& other, float tolerance) const noexcept
+{
+    return previousState == other.previousState
+        && currentState == other.currentState
+        && flipFlopState == other.flipFlopState
+        && flipFlopState2 == other.flipFlopState2
+        && std::abs(pendingSquare - other.pendingSquare) <= tolerance
+        && std::abs(previousInput - other.previousInput) <= tolerance
+        && std::abs(smoothingState - other.smoothingState) <= tolerance;
 }
 
 void OctaveDivider::updateFilterCoefficients()
 {
     // Low-pass filter at 300Hz for output smoothing
     // This adds analog "warmth" and removes harsh digital artifacts
-    auto coeffs = juce::dsp::IIR::Coefficients<float>::makeFirstOrderLowPass(
-        sampleRate,
-        300.0  // Cutoff frequency
-    );
-    smoothingFilter.coefficients = coeffs;
+    // (same coefficients as juce::dsp::IIR::Coefficients::makeFirstOrderLowPass)
+    const float n = std::tan(std::numbers::pi_v<float> * static_cast<float>(300.0 / sampleRate));
+    const float a0Inverse = 1.0f / (n + 1.0f);
+    smoothingB0 = n * a0Inverse;
+    smoothingA1 = (n - 1.0f) * a0Inverse;
 }
 
 void OctaveDivider::setSensitivity(float sensitivity)
@@ -43,12 +57,13 @@ float OctaveDivider::processSample(float input)
 {
     // Step 1: Convert input to square wave with hysteresis
     // This prevents false triggering on noise
+    const float trigger = threshold + hysteresis;
 
-    if (input > threshold + hysteresis)
+    if (input > trigger)
     {
         currentState = true;   // HIGH
     }
-    else if (input < -(threshold + hysteresis))
+    else if (input < -trigger)
     {
         currentState = false;  // LOW
     }
@@ -75,17 +90,32 @@ float OctaveDivider::processSample(float input)
         }
     }
 
+    // Step 4: Convert flip-flop boolean state to audio signal
+    // HIGH = +1.0, LOW = -1.0, one sample late so a step can be corrected on both sides
+    float output = pendingSquare;
+    pendingSquare = flipFlopState ? 1.0f : -1.0f;
+
+    if (risingEdge)
+    {
+        // Where between the two samples the input crossed the trigger (clamped: a
+        // sensitivity change can move the trigger below the previous input)
+        const float level = pendingSquare;
+        const float elapsed = std::clamp((input - trigger) / (input - previousInput), 0.0f, 1.0f);
+        const float remaining = 1.0f - elapsed;
+
+        output += level * elapsed * elapsed;
+        pendingSquare -= level * remaining * remaining;
+    }
+
     // Update previous state for next sample
     previousState = currentState;
     previousInput = input;
 
-    // Step 4: Convert flip-flop boolean state to audio signal
-    // HIGH = +1.0, LOW = -1.0 (creates perfect square wave)
-    float output = flipFlopState ? 1.0f : -1.0f;
-
     // Step 5: Apply smoothing filter to add analog character
     // This mimics the RC filter in analog circuits
-    output = smoothingFilter.processSample(output);
+    const float smoothed = smoothingB0 * output + smoothingState;
+    smoothingState = smoothingB0 * output - smoothingA1 * smoothed;
+    output = smoothed;
 
     return output;
 }
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <juce_dsp/juce_dsp.h>
 #include <cmath>
 
 /**
@@ -13,8 +12,21 @@
  * 1. Convert input to square wave via zero-crossing detection with hysteresis
  * 2. Detect rising edges
  * 3. Toggle flip-flop state on each rising edge
- * 4. Convert boolean state to audio signal
+ * 4. Convert boolean state to a band-limited square (PolyBLEP)
  * 5. Smooth output with low-pass filter to add analog warmth
+ *
+ * A naive ±1 square steps on whole samples, and every step aliases. The
+ * edge time is interpolated between the two input samples around the
+ * comparator threshold, and the step is replaced by a 2-sample polynomial
+ * band-limited step centred on it:
+ *
+ *   d = (input - trigger) / (input - previousInput)   // fraction of the period since the edge
+ *   y[n-1] += level * d^2                             // level = new state (±1), step = 2 * level
+ *   y[n]   -= level * (1 - d)^2
+ *
+ * The correction reaches one sample back, so the square is delayed by one
+ * sample (20us at 48kHz, far below the octave's period). Its edges are only
+ * steps, so no BLAMP is needed; the smoothing filter follows the corrected square.
  */
 class OctaveDivider
 {
@@ -39,6 +51,12 @@ public:
      */
     void reset();
 
+    /**
+     * Same flip-flop states, and smoothing state within tolerance
+     * (the outputs for the same input then match)
+     */
+    bool hasStateOf(const OctaveDivider& other, float tolerance) const noexcept;
+
     /**
      * Set the tracking sensitivity (threshold adjustment)
      * @param sensitivity 0.0-1.0 (lower = tighter tracking, higher = looser)
@@ -58,12 +76,17 @@ private:
     // Flip-flop state (-1 octave)
     bool flipFlopState = false;
 
+    // Band-limited square for the previous sample (the PolyBLEP correction's lookahead)
+    float pendingSquare = -1.0f;
+
     // Second stage flip-flop state (-2 octave, optional)
     bool flipFlopState2 = false;
 
-    // Output smoothing filter (1-pole low-pass at ~300Hz)
+    // Output smoothing filter (1-pole low-pass at ~300Hz, bilinear transform)
     // Mimics capacitor smoothing in analog circuit
-    juce::dsp::IIR::Filter<float> smoothingFilter;
+    float smoothingB0 = 0.0f;           // b0 == b1
+    float smoothingA1 = 0.0f;
+    float smoothingState = 0.0f;
 
     // Previous input for edge detection
     float previousInput = 0.0f;
@@ -0,0 +1,136 @@
+#include "PartitionedConvolver.h"
+#include "SimdFloat.h"
+#include <algorithm>
+
+static_assert(CabinetImpulse::binStride % SimdFloat::width == 0, "Spectra must be whole SIMD vectors");
+
+PartitionedConvolver::PartitionedConvolver()
+{
+}
+
+void PartitionedConvolver::prepare(std::shared_ptr<const CabinetImpulse> newImpulse)
+{
+    impulse = std::move(newImpulse);
+
+    const auto spectrumSize = static_cast<size_t>(impulse != nullptr ? impulse->getNumPartitions() * CabinetImpulse::binStride : 0);
+    fdlReal.assign(spectrumSize, 0.0f);
+    fdlImag.assign(spectrumSize, 0.0f);
+
+    reset();
+}
+
+void PartitionedConvolver::reset()
+{
+    frame.fill(0.0f);
+    tail.fill(0.0f);
+    std::fill(fdlReal.begin(), fdlReal.end(), 0.0f);
+    std::fill(fdlImag.begin(), fdlImag.end(), 0.0f);
+    position = 0;
+    fdlHead = 0;
+}
+
+void PartitionedConvolver::process(float* samples, int numSamples)
+{
+    if (impulse == nullptr)
+        return;
+
+    const float* reversedHead = impulse->getReversedHead();
+    std::array<float, blockSize> output;
+
+    for (int done = 0; done < numSamples;)
+    {
+        // Up to the end of the current block
+        const int run = std::min(numSamples - done, blockSize - position);
+        float* current = frame.data() + blockSize + position;
+
+        std::copy(samples + done, samples + done + run, current);
+        std::copy(tail.begin() + position, tail.begin() + position + run, output.begin());
+
+        // Head: output[j] = sum over taps t < blockSize of h[t] * x[j - t]. Vectors of
+        // adjacent output samples, so every lane accumulates its own sum in tap order
+        const float* history = current - (blockSize - 1);
+        int j = 0;
+
+        for (; j + SimdFloat::width <= run; j += SimdFloat::width)
+        {
+            auto sum = SimdFloat::load(output.data() + j);
+
+            for (int m = 0; m < blockSize; ++m)
+                sum = sum + SimdFloat::broadcast(reversedHead[m]) * SimdFloat::load(history + j + m);
+
+            sum.store(output.data() + j);
+        }
+
+        for (; j < run; ++j)
+        {
+            float sum = output[static_cast<size_t>(j)];
+
+            for (int m = 0; m < blockSize; ++m)
+                sum += reversedHead[m] * history[j + m];
+
+            output[static_cast<size_t>(j)] = sum;
+        }
+
+        std::copy(output.begin(), output.begin() + run, samples + done);
+
+        position += run;
+        done += run;
+
+        if (position == blockSize)
+        {
+            finishBlock();
+            position = 0;
+        }
+    }
+}
+
+void PartitionedConvolver::finishBlock()
+{
+    const int numPartitions = impulse->getNumPartitions();
+
+    if (numPartitions > 0)
+    {
+        constexpr int stride = CabinetImpulse::binStride;
+        const auto& fft = impulse->getFFT();
+
+        // Newest input spectrum: the last two blocks (overlap-save)
+        fdlHead = fdlHead + 1 < numPartitions ? fdlHead + 1 : 0;
+        float* newestReal = fdlReal.data() + fdlHead * stride;
+        float* newestImag = fdlImag.data() + fdlHead * stride;
+        fft.forward(frame.data(), newestReal, newestImag, fftScratch.data());
+
+        // Sum of partition p times the input spectrum p blocks old
+        sumReal.fill(0.0f);
+        sumImag.fill(0.0f);
+
+        int slot = fdlHead;
+
+        for (int partition = 0; partition < numPartitions; ++partition)
+        {
+            const float* inputReal = fdlReal.data() + slot * stride;
+            const float* inputImag = fdlImag.data() + slot * stride;
+            const float* impulseReal = impulse->getPartitionReal(partition);
+            const float* impulseImag = impulse->getPartitionImag(partition);
+
+            for (int bin = 0; bin < stride; bin += SimdFloat::width)
+            {
+                const auto xr = SimdFloat::load(inputReal + bin);
+                const auto xi = SimdFloat::load(inputImag + bin);
+                const auto hr = SimdFloat::load(impulseReal + bin);
+                const auto hi = SimdFloat::load(impulseImag + bin);
+
+                (SimdFloat::load(sumReal.data() + bin) + xr * hr - xi * hi).store(sumReal.data() + bin);
+                (SimdFloat::load(sumImag.data() + bin) + xr * hi + xi * hr).store(sumImag.data() + bin);
+            }
+
+            slot = slot > 0 ? slot - 1 : numPartitions - 1;
+        }
+
+        // The second half of the circular convolution is the linear one (overlap-save)
+        fft.inverse(sumReal.data(), sumImag.data(), transformed.data(), fftScratch.data());
+        std::copy(transformed.begin() + blockSize, transformed.end(), tail.begin());
+    }
+
+    // The completed block becomes the previous one
+    std::copy(frame.begin() + blockSize, frame.end(), frame.begin());
+}
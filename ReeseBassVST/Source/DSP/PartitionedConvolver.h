@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+#include "CabinetImpulse.h"
+
+/**
+ * PartitionedConvolver - Zero-Latency Uniformly Partitioned Convolution
+ *
+ * Convolves one channel with a shared CabinetImpulse:
+ *
+ *   head  (taps 0-63)   direct form, sample by sample     -> no latency
+ *   tail  (taps 64-)    overlap-save FFT convolution in 64-sample partitions,
+ *                       through a frequency-domain delay line (FDL)
+ *
+ * The tail of the output in block k+1 only depends on input up to the end of
+ * block k, so it is computed as each block of input completes: one forward
+ * FFT of the last two blocks into the FDL, one complex multiply-add per
+ * partition over the FDL, and one inverse FFT. The head fills in the current
+ * block's own contribution. Blocks run on the convolver's own 64-sample grid,
+ * so process() takes any number of samples per call.
+ *
+ * Per sample this costs 64 multiply-adds for the head plus, per partition,
+ * about one complex multiply-add (in SIMD vectors) - against a generic
+ * convolver sized for the host block, there is no latency to compensate and
+ * the IR spectra are not duplicated per instance.
+ *
+ * prepare() allocates the FDL for the impulse, so it runs where the impulse
+ * is built; process() and reset() never allocate.
+ */
+class PartitionedConvolver
+{
+public:
+    static constexpr int blockSize = CabinetImpulse::blockSize;
+
+    PartitionedConvolver();
+
+    /**
+     * Use an impulse (allocates: not on the audio thread)
+     */
+    void prepare(std::shared_ptr<const CabinetImpulse> newImpulse);
+
+    /**
+     * Clear the input history (no allocation)
+     */
+    void reset();
+
+    /**
+     * Convolve samples in place
+     */
+    void process(float* samples, int numSamples);
+
+    const CabinetImpulse* getImpulse() const noexcept { return impulse.get(); }
+
+private:
+    // A block of input completed: push its spectrum and compute the next block's tail
+    void finishBlock();
+
+    using Spectrum = std::array<float, CabinetImpulse::binStride>;
+
+    std::shared_ptr<const CabinetImpulse> impulse;
+
+    // Time-domain input: the previous block, then the current one (overlap-save frame)
+    alignas(32) std::array<float, 2 * blockSize> frame {};
+    alignas(32) std::array<float, blockSize> tail {};   // Tail output of the current block
+    int position = 0;                                   // Samples into the current block
+
+    // Input spectra of the last numPartitions blocks (ring, newest at fdlHead)
+    std::vector<float> fdlReal;
+    std::vector<float> fdlImag;
+    int fdlHead = 0;
+
+    // Scratch for finishBlock()
+    alignas(32) Spectrum sumReal {};
+    alignas(32) Spectrum sumImag {};
+    alignas(32) std::array<float, 2 * blockSize> transformed {};
+    alignas(32) std::array<float, 2 * blockSize> fftScratch {};
+};
@@ -0,0 +1,186 @@
+#include "RealFFT.h"
+#include "SimdFloat.h"
+#include <cmath>
+#include <numbers>
+
+RealFFT::RealFFT(int order)
+    : size(1 << order), half(size / 2)
+{
+    const int bits = order - 1;
+    bitReversed.resize(static_cast<size_t>(half));
+
+    for (int n = 0; n < half; ++n)
+    {
+        int reversed = 0;
+        for (int bit = 0; bit < bits; ++bit)
+            reversed |= ((n >> bit) & 1) << (bits - 1 - bit);
+
+        bitReversed[static_cast<size_t>(n)] = reversed;
+    }
+
+    constexpr double pi = std::numbers::pi;
+
+    // Twiddles of each stage in butterfly order, so the inner loop reads them contiguously
+    for (int span = 4; span < half; span *= 2)
+    {
+        for (int j = 0; j < span; ++j)
+        {
+            cosTable.push_back(static_cast<float>(std::cos(pi * j / span)));
+            sinTable.push_back(static_cast<float>(std::sin(pi * j / span)));
+        }
+    }
+
+    for (int k = 0; k <= half; ++k)
+    {
+        splitCos.push_back(static_cast<float>(std::cos(2.0 * pi * k / size)));
+        splitSin.push_back(static_cast<float>(std::sin(2.0 * pi * k / size)));
+    }
+}
+
+void RealFFT::transform(float* real, float* imag) const noexcept
+{
+    // Decimation in time on bit-reversed input. Spans 1 and 2 in one pass: their
+    // twiddles are 1 and -i, so no multiplies
+    for (int start = 0; start < half; start += 4)
+    {
+        float* r = real + start;
+        float* i = imag + start;
+
+        const float sum01Real = r[0] + r[1], sum01Imag = i[0] + i[1];
+        const float dif01Real = r[0] - r[1], dif01Imag = i[0] - i[1];
+        const float sum23Real = r[2] + r[3], sum23Imag = i[2] + i[3];
+        const float dif23Real = r[2] - r[3], dif23Imag = i[2] - i[3];
+
+        r[0] = sum01Real + sum23Real;
+        i[0] = sum01Imag + sum23Imag;
+        r[2] = sum01Real - sum23Real;
+        i[2] = sum01Imag - sum23Imag;
+
+        // -i * dif23
+        r[1] = dif01Real + dif23Imag;
+        i[1] = dif01Imag - dif23Real;
+        r[3] = dif01Real - dif23Imag;
+        i[3] = dif01Imag + dif23Real;
+    }
+
+    // Spans 4, 8, ... half / 2: b * exp(-pi i j / span)
+    for (int span = 4; span < half; span *= 2)
+    {
+        const float* stageCos = cosTable.data() + span - 4;
+        const float* stageSin = sinTable.data() + span - 4;
+
+        for (int start = 0; start < half; start += 2 * span)
+        {
+            float* aReal = real + start;
+            float* aImag = imag + start;
+            float* bReal = aReal + span;
+            float* bImag = aImag + span;
+            int j = 0;
+
+            for (; j + SimdFloat::width <= span; j += SimdFloat::width)
+            {
+                const auto c = SimdFloat::load(stageCos + j);
+                const auto s = SimdFloat::load(stageSin + j);
+                const auto br = SimdFloat::load(bReal + j);
+                const auto bi = SimdFloat::load(bImag + j);
+                const auto ar = SimdFloat::load(aReal + j);
+                const auto ai = SimdFloat::load(aImag + j);
+                const auto tReal = c * br + s * bi;
+                const auto tImag = c * bi - s * br;
+
+                (ar - tReal).store(bReal + j);
+                (ai - tImag).store(bImag + j);
+                (ar + tReal).store(aReal + j);
+                (ai + tImag).store(aImag + j);
+            }
+
+            for (; j < span; ++j)
+            {
+                const float c = stageCos[j];
+                const float s = stageSin[j];
+                const float tReal = c * bReal[j] + s * bImag[j];
+                const float tImag = c * bImag[j] - s * bReal[j];
+
+                bReal[j] = aReal[j] - tReal;
+                bImag[j] = aImag[j] - tImag;
+                aReal[j] += tReal;
+                aImag[j] += tImag;
+            }
+        }
+    }
+}
+
+void RealFFT::forward(const float* input, float* real, float* imag, float* scratch) const noexcept
+{
+    float* zReal = scratch;
+    float* zImag = scratch + half;
+
+    // Even samples as real, odd as imaginary parts, loaded in bit-reversed order
+    for (int n = 0; n < half; ++n)
+    {
+        const auto position = static_cast<size_t>(bitReversed[static_cast<size_t>(n)]);
+        zReal[position] = input[2 * n];
+        zImag[position] = input[2 * n + 1];
+    }
+
+    transform(zReal, zImag);
+
+    for (int k = 0; k <= half; ++k)
+    {
+        const int a = k < half ? k : 0;
+        const int b = k > 0 ? half - k : 0;
+
+        // Even part E and odd part D of the packed spectrum: X = E - i W^k D
+        const float eReal = 0.5f * (zReal[a] + zReal[b]);
+        const float eImag = 0.5f * (zImag[a] - zImag[b]);
+        const float dReal = 0.5f * (zReal[a] - zReal[b]);
+        const float dImag = 0.5f * (zImag[a] + zImag[b]);
+        const float c = splitCos[static_cast<size_t>(k)];
+        const float s = splitSin[static_cast<size_t>(k)];
+
+        real[k] = eReal + c * dImag - s * dReal;
+        imag[k] = eImag - c * dReal - s * dImag;
+    }
+
+    imag[0] = 0.0f;
+    imag[half] = 0.0f;
+}
+
+void RealFFT::inverse(const float* real, const float* imag, float* output, float* scratch) const noexcept
+{
+    float* zReal = scratch;
+    float* zImag = scratch + half;
+
+    for (int k = 0; k < half; ++k)
+    {
+        const int mirror = half - k;
+
+        // DC and Nyquist bins are real whatever the caller's imaginary parts
+        const float aImag = k == 0 ? 0.0f : imag[k];
+        const float bImag = k == 0 ? 0.0f : imag[mirror];
+
+        const float eReal = 0.5f * (real[k] + real[mirror]);
+        const float eImag = 0.5f * (aImag - bImag);
+        const float dReal = 0.5f * (real[k] - real[mirror]);
+        const float dImag = 0.5f * (aImag + bImag);
+        const float c = splitCos[static_cast<size_t>(k)];
+        const float s = splitSin[static_cast<size_t>(k)];
+
+        // O = conj(W^k) D, then Z = E + i O
+        const float oReal = c * dReal - s * dImag;
+        const float oImag = c * dImag + s * dReal;
+
+        const auto position = static_cast<size_t>(bitReversed[static_cast<size_t>(k)]);
+        zReal[position] = eReal - oImag;
+        zImag[position] = eImag + oReal;
+    }
+
+    // Inverse transform: the forward one with real and imaginary parts swapped
+    transform(zImag, zReal);
+
+    for (int n = 0; n < half; ++n)
+    {
+        output[2 * n] = zReal[n];
+        output[2 * n + 1] = zImag[n];
+    }
+}
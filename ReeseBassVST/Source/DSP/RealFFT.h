@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * RealFFT - Power-of-Two FFT of Real Signals
+ *
+ * A real sequence of size N is packed into N/2 complex values
+ * (z[n] = x[2n] + i x[2n+1]), transformed with an iterative radix-2 complex
+ * FFT, and split into the N/2 + 1 non-redundant bins of the real spectrum:
+ *
+ *   X[k] = (Z[k] + conj(Z[N/2-k])) / 2 - i W^k (Z[k] - conj(Z[N/2-k])) / 2,   W = exp(-2 pi i / N)
+ *
+ * so a real transform costs about half a complex one of the same size.
+ * Spectra are kept as separate real and imaginary arrays (bins 0 to N/2),
+ * the layout in which per-bin products vectorize. Twiddles and the
+ * bit-reversal table are built by the constructor; transforms only use the
+ * caller's buffers and the scratch passed in, so one RealFFT can be shared
+ * read-only by any number of threads.
+ *
+ * inverse() is unnormalized: inverse(forward(x)) = (N / 2) * x.
+ */
+class RealFFT
+{
+public:
+    /**
+     * @param order log2 of the transform size (3 or more)
+     */
+    explicit RealFFT(int order);
+
+    int getSize() const noexcept { return size; }
+    int getNumBins() const noexcept { return size / 2 + 1; }
+
+    /**
+     * Spectrum of size real samples
+     * @param input size samples
+     * @param real, imag getNumBins() bins each
+     * @param scratch size floats
+     */
+    void forward(const float* input, float* real, float* imag, float* scratch) const noexcept;
+
+    /**
+     * Real signal of a spectrum (scaled by size / 2)
+     * @param real, imag getNumBins() bins each (only the real part of bins 0 and size / 2 is used)
+     * @param output size samples
+     * @param scratch size floats
+     */
+    void inverse(const float* real, const float* imag, float* output, float* scratch) const noexcept;
+
+private:
+    // In-place complex FFT of size / 2 points; swapping real and imag gives the inverse
+    void transform(float* real, float* imag) const noexcept;
+
+    int size;
+    int half;                          // Complex points
+    std::vector<int> bitReversed;      // Index permutation of the complex points
+    std::vector<float> cosTable;       // Per stage of span 4, 8, ...: cos/sin(pi j / span), j < span,
+    std::vector<float> sinTable;       // stored contiguously from index span - 4
+    std::vector<float> splitCos;       // cos/sin(2 pi k / size), k <= half
+    std::vector<float> splitSin;
+};
@@ -0,0 +1,231 @@
+#include "ReeseChain.h"
+
+ReeseChain::MixLevels ReeseChain::MixLevels::fromCharacter(float character) noexcept
+{
+    // Character: 0% = clean bass, 100% = maximum chaos
+    MixLevels levels;
+
+    levels.clean = 0.5f - (character * 0.3f);           // Decreases slightly
+    levels.subOctave = 0.2f + (character * 0.4f);       // Increases
+    levels.ringMod = character * 0.6f;                  // Increases strongly
+    levels.ringModOctave = character * character * 0.4f; // Quadratic increase
+
+    return levels;
+}
+
+//==============================================================================
+ReeseChain::ReeseChain()
+{
+}
+
+void ReeseChain::prepare(double sampleRate)
+{
+    octaveDivider.prepare(sampleRate);
+    ringModulator.prepare(sampleRate);
+    filter1.prepare(sampleRate);
+    filter2.prepare(sampleRate);
+    filter3.prepare(sampleRate);
+    ladder1.prepare(sampleRate);
+    ladder2.prepare(sampleRate);
+    ladder3.prepare(sampleRate);
+    waveShaper.prepare(sampleRate);
+    noiseGen.prepare(sampleRate);
+}
+
+void ReeseChain::reset()
+{
+    octaveDivider.reset();
+    ringModulator.reset();
+    filter1.reset();
+    filter2.reset();
+    filter3.reset();
+    ladder1.reset();
+    ladder2.reset();
+    ladder3.reset();
+    waveShaper.reset();
+    noiseGen.reset();
+}
+
+void ReeseChain::seed(std::uint32_t value)
+{
+    ringModulator.seed(value);
+    noiseGen.seed(value ^ 0x9e3779b9u);   // Decorrelated from the ring's stream
+}
+
+void ReeseChain::setSettings(const Settings& settings)
+{
+    // Only the filters in use follow the settings. Switching model starts the
+    // other model's filters from silence rather than from a stale state
+    if (settings.filterModel != filterModel)
+    {
+        filterModel = settings.filterModel;
+        filter1.reset();
+        filter2.reset();
+        filter3.reset();
+        ladder1.reset();
+        ladder2.reset();
+        ladder3.reset();
+    }
+
+    if (filterModel == FilterModel::LADDER)
+    {
+        for (auto* ladder : { &ladder1, &ladder2, &ladder3 })
+        {
+            ladder->setCutoff(settings.cutoff);
+            ladder->setResonance(settings.resonance);
+        }
+    }
+    else
+    {
+        filter1.setCutoff(settings.cutoff);
+        filter1.setResonance(settings.resonance);
+        filter2.setCutoff(settings.cutoff);
+        filter2.setResonance(settings.resonance);
+        filter3.setCutoff(settings.cutoff);
+        filter3.setResonance(settings.resonance);
+    }
+
+    ringModulator.setFrequency(settings.ringRate);
+    ringModulator.setDepth(settings.ringDepth);
+    waveShaper.setDrive(settings.drive);
+    noiseGen.setAmount(settings.noiseAmount);
+}
+
+ReeseChain::Sample ReeseChain::processSample(float input, const MixLevels& mixLevels, float octaveBlend)
+{
+    return processSample(input, processOctave(input), mixLevels, octaveBlend);
+}
+
+float ReeseChain::processOctave(float input)
+{
+    StageTrace::Lap lap;
+
+    // Octave divider path
+    const float octave = octaveDivider.processSample(input);
+    lap.mark(StageTrace::Stage::OCTAVE);
+    const float filtered = filterPath(filter1, ladder1, octave);
+    lap.mark(StageTrace::Stage::FILTERS);
+
+    return filtered;
+}
+
+ReeseChain::Sample ReeseChain::processSample(float input, float octave, const MixLevels& mixLevels, float octaveBlend)
+{
+    Sample result;
+    result.clean = input;
+    result.octave = octave;
+
+    StageTrace::Lap lap;
+
+    // Ring mod path
+    result.ring = ringModulator.processSample(input);
+    lap.mark(StageTrace::Stage::RING);
+    result.ring = filterPath(filter2, ladder2, result.ring);
+    lap.mark(StageTrace::Stage::FILTERS);
+
+    // Combined path (ring mod + octave)
+    result.combined = ringModulator.processSample(result.octave);
+    lap.mark(StageTrace::Stage::RING);
+    result.combined = filterPath(filter3, ladder3, result.combined);
+    lap.mark(StageTrace::Stage::FILTERS);
+
+    const float shaped = mixAndShape(result, mixLevels, octaveBlend, lap);
+
+    // Add noise
+    result.output = noiseGen.apply(shaped);
+    lap.mark(StageTrace::Stage::NOISE);
+
+    return result;
+}
+
+ReeseChain::SharedPaths ReeseChain::processShared(float input)
+{
+    SharedPaths paths;
+    paths.clean = input;
+    paths.octave = processOctave(input);
+
+    StageTrace::Lap lap;
+
+    paths.ring = filterPath(filter2, ladder2, input);
+    paths.combined = filterPath(filter3, ladder3, paths.octave);
+    lap.mark(StageTrace::Stage::FILTERS);
+
+    paths.noise = noiseGen.apply(0.0f);
+    lap.mark(StageTrace::Stage::NOISE);
+
+    return paths;
+}
+
+ReeseChain::Sample ReeseChain::processLinked(const SharedPaths& paths, const MixLevels& mixLevels, float octaveBlend)
+{
+    Sample result;
+    result.clean = paths.clean;
+    result.octave = paths.octave;
+
+    StageTrace::Lap lap;
+
+    // The modulator itself (unit input); the LFO advances twice per sample as in processSample()
+    result.ring = paths.ring * ringModulator.processSample(1.0f);
+    result.combined = paths.combined * ringModulator.processSample(1.0f);
+    lap.mark(StageTrace::Stage::RING);
+
+    result.output = mixAndShape(result, mixLevels, octaveBlend, lap) + paths.noise;
+    return result;
+}
+
+float ReeseChain::filterPath(StateVariableFilter& svf, LadderFilter& ladder, float input)
+{
+    if (filterModel == FilterModel::LADDER)
+        return ladder.processSample(input);
+
+    return svf.processSample(input).lowPass;
+}
+
+float ReeseChain::mixAndShape(const Sample& paths, const MixLevels& mixLevels, float octaveBlend, StageTrace::Lap& lap)
+{
+    // Mix all paths
+    float mixed = (paths.clean * mixLevels.clean) +
+                  (paths.octave * mixLevels.subOctave * octaveBlend) +
+                  (paths.ring * mixLevels.ringMod) +
+                  (paths.combined * mixLevels.ringModOctave);
+
+    // Apply saturation
+    mixed = waveShaper.process(mixed);
+    lap.mark(StageTrace::Stage::SHAPER);
+
+    return mixed;
+}
+
+bool ReeseChain::hasOctaveStateOf(const ReeseChain& other, float tolerance) const noexcept
+{
+    return octaveDivider.hasStateOf(other.octaveDivider, tolerance)
+        && filterModel == other.filterModel
+        && (filterModel == FilterModel::LADDER ? ladder1.hasStateOf(other.ladder1, tolerance)
+                                               : filter1.hasStateOf(other.filter1, tolerance));
+}
+
+void ReeseChain::copyOctaveState(const ReeseChain& other)
+{
+    octaveDivider = other.octaveDivider;
+    filter1 = other.filter1;
+    ladder1 = other.ladder1;
+}
+
+void ReeseChain::copyPathState(const ReeseChain& other)
+{
+    copyOctaveState(other);
+    filter2 = other.filter2;
+    filter3 = other.filter3;
+    ladder2 = other.ladder2;
+    ladder3 = other.ladder3;
+}
+
+float ReeseChain::processBand(float band, float amount, const MixLevels& mixLevels, float octaveBlend)
+{
+    // Clean band costs nothing: the ring/octave/filter paths are skipped entirely
+    if (amount <= 0.0f)
+        return band;
+
+    const float processed = processSample(band, mixLevels, octaveBlend).output;
+    return band + amount * (processed - band);
+}
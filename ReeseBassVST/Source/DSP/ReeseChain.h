@@ -0,0 +1,191 @@
+#pragma once
+
+#include "OctaveDivider.h"
+#include "RingModulator.h"
+#include "StateVariableFilter.h"
+#include "LadderFilter.h"
+#include "WaveShapers.h"
+#include "NoiseGenerator.h"
+#include "../Profiling/StageTrace.h"
+
+/**
+ * ReeseChain - One Mono Reese Bass Chain
+ *
+ * The signal path of one plugin channel (or one multiband band), independent
+ * of the processor and of JUCE:
+ *
+ *   octave divider -> SVF ─┐
+ *   ring mod       -> SVF ─┼─ mix -> wave shaper -> + noise
+ *   ring(octave)   -> SVF ─┘
+ *
+ * Each SVF can be replaced by a nonlinear ladder (Settings::filterModel).
+ *
+ * The caller owns smoothing, modulation, volume and the output stage: it
+ * calls setSettings() with the current values (per sample or per block),
+ * then processSample(). Nothing here allocates after prepare().
+ */
+class ReeseChain
+{
+public:
+    /**
+     * Path levels derived from the Character parameter
+     */
+    struct MixLevels
+    {
+        float clean = 0.5f;
+        float subOctave = 0.2f;
+        float ringMod = 0.0f;
+        float ringModOctave = 0.0f;
+
+        /**
+         * @param character 0.0 = clean bass, 1.0 = maximum chaos
+         */
+        static MixLevels fromCharacter(float character) noexcept;
+    };
+
+    /**
+     * Filter in each of the three paths
+     */
+    enum class FilterModel
+    {
+        SVF,      // 2-pole trapezoidal state variable (StateVariableFilter)
+        LADDER    // 4-pole nonlinear ZDF ladder (LadderFilter, about 8x the cost)
+    };
+
+    /**
+     * Per-sample sound settings (real units, as parameterTable)
+     */
+    struct Settings
+    {
+        float cutoff = 500.0f;      // Hz
+        float resonance = 0.6f;     // 0.0-0.95
+        float ringRate = 3.0f;      // Hz
+        float ringDepth = 0.5f;
+        float drive = 1.0f;         // 0.0-2.0
+        float noiseAmount = 0.2f;
+        FilterModel filterModel = FilterModel::SVF;
+    };
+
+    /**
+     * Signals of every path for one sample (output is before volume and limiting)
+     */
+    struct Sample
+    {
+        float clean;
+        float octave;
+        float ring;
+        float combined;
+        float output;
+    };
+
+    /**
+     * Filtered paths of one sample before ring modulation, and the noise (Linked
+     * Stereo: computed once on the mid signal, then modulated by each channel's LFO)
+     */
+    struct SharedPaths
+    {
+        float clean = 0.0f;
+        float octave = 0.0f;
+        float ring = 0.0f;       // Filtered input
+        float combined = 0.0f;   // Filtered octave path
+        float noise = 0.0f;      // Added after the wave shaper
+    };
+
+    ReeseChain();
+
+    /**
+     * Prepare every module for processing
+     * @param sampleRate The sample rate in Hz
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * Reset every module's state (settings are kept)
+     */
+    void reset();
+
+    /**
+     * Reseed the ring modulator and noise generator (until then they use a fixed seed)
+     */
+    void seed(std::uint32_t value);
+
+    void setSettings(const Settings& settings);
+
+    /**
+     * Process a single sample through every path
+     * @param input Input audio sample
+     * @param mixLevels Path levels (see MixLevels::fromCharacter)
+     * @param octaveBlend Extra gain on the octave path (0.0-1.0)
+     */
+    Sample processSample(float input, const MixLevels& mixLevels, float octaveBlend);
+
+    /**
+     * The octave path (divider and its filter) on its own. For dual-mono input
+     * one chain runs it and both channels' chains use the result
+     */
+    float processOctave(float input);
+
+    /**
+     * processSample() with the octave path already computed by processOctave()
+     * (of this chain, or of another chain fed the same input)
+     */
+    Sample processSample(float input, float octave, const MixLevels& mixLevels, float octaveBlend);
+
+    /**
+     * Linked Stereo, shared part: the octave divider and all three filters, unmodulated,
+     * and the noise
+     */
+    SharedPaths processShared(float input);
+
+    /**
+     * Linked Stereo, per channel: this chain's ring LFO applied after the filters
+     * (it is sub-audio, so it commutes with them up to the filters' input
+     * saturation), then the mix and wave shaper; the shared noise is added
+     */
+    Sample processLinked(const SharedPaths& paths, const MixLevels& mixLevels, float octaveBlend);
+
+    /**
+     * Octave path state within tolerance of another chain's, so either chain's
+     * processOctave() can stand in for the other's
+     */
+    bool hasOctaveStateOf(const ReeseChain& other, float tolerance) const noexcept;
+
+    /**
+     * Take over another chain's octave path state, e.g. when this chain resumes
+     * its own octave path after dual-mono input
+     */
+    void copyOctaveState(const ReeseChain& other);
+
+    /**
+     * Take over another chain's octave divider and filter state (after Linked Stereo)
+     */
+    void copyPathState(const ReeseChain& other);
+
+    /**
+     * Blend one crossover band between clean (amount 0, chain skipped) and the chain
+     * @param amount 0.0-1.0
+     */
+    float processBand(float band, float amount, const MixLevels& mixLevels, float octaveBlend);
+
+    // The ring LFO, e.g. to follow it as a modulation source
+    const RingModulator& getRingModulator() const noexcept { return ringModulator; }
+
+private:
+    // One path's filter in the current model
+    float filterPath(StateVariableFilter& svf, LadderFilter& ladder, float input);
+
+    // Path mix and wave shaper
+    float mixAndShape(const Sample& paths, const MixLevels& mixLevels, float octaveBlend, StageTrace::Lap& lap);
+
+    OctaveDivider octaveDivider;
+    RingModulator ringModulator;
+    StateVariableFilter filter1;  // For octave path
+    StateVariableFilter filter2;  // For ring mod path
+    StateVariableFilter filter3;  // For combined path
+    LadderFilter ladder1;         // The same paths with the ladder model
+    LadderFilter ladder2;
+    LadderFilter ladder3;
+    FilterModel filterModel = FilterModel::SVF;
+    WaveShapers waveShaper;
+    NoiseGenerator noiseGen;
+};
@@ -1,7 +1,7 @@
 #include "RingModulator.h"
 
 RingModulator::RingModulator()
-    : rng(std::random_device{}()),
+    : rng(0x5eed),   // Fixed until seed(): constructing never touches the OS entropy source
       distribution(-0.05f, 0.05f)
 {
 }
@@ -9,6 +9,13 @@ RingModulator::RingModulator()
 void RingModulator::prepare(double newSampleRate)
 {
     sampleRate = newSampleRate;
+
+    if (sineTable == nullptr)
+    {
+        sineTable = SharedTables::acquire(SharedTables::Type::SINE_CYCLE);
+        modifiedSineTable = SharedTables::acquire(SharedTables::Type::MODIFIED_SINE_CYCLE);
+    }
+
     reset();
 }
 
@@ -18,14 +25,19 @@ void RingModulator::reset()
     phaseOffset = 0.0f;
 }
 
+void RingModulator::seed(std::uint32_t value)
+{
+    rng.seed(value);
+}
+
 void RingModulator::setFrequency(float hz)
 {
-    lfoFrequency = juce::jlimit(0.5f, 10.0f, hz);
+    lfoFrequency = std::clamp(hz, 0.5f, 10.0f);
 }
 
 void RingModulator::setDepth(float depth)
 {
-    modulationDepth = juce::jlimit(0.0f, 1.0f, depth);
+    modulationDepth = std::clamp(depth, 0.0f, 1.0f);
 }
 
 void RingModulator::setWaveShape(WaveShape shape)
@@ -33,6 +45,11 @@ void RingModulator::setWaveShape(WaveShape shape)
     currentShape = shape;
 }
 
+float RingModulator::getLfoValue()
+{
+    return generateLFO();
+}
+
 float RingModulator::processSample(float input)
 {
     // Generate LFO output for current phase
@@ -95,22 +112,16 @@ float RingModulator::generateLFO()
 float RingModulator::generateSine()
 {
     // Pure sine wave
-    return std::sin(2.0f * juce::MathConstants<float>::pi * lfoPhase);
+    return sineTable->lookup(lfoPhase);
 }
 
 float RingModulator::generateModifiedSine()
 {
-    // Modified sine with added harmonics (mimics analog VCO imperfections)
-    // Adds 3rd harmonic at 15% amplitude for richer character
-    float fundamental = std::sin(2.0f * juce::MathConstants<float>::pi * lfoPhase);
-    float harmonic = std::sin(6.0f * juce::MathConstants<float>::pi * lfoPhase);
-
-    float output = fundamental + (0.15f * harmonic);
-
-    // Soft clipping to prevent exceeding ±1.0 range
-    output = std::tanh(output * 1.3f);
-
-    return output;
+    // Modified sine with added harmonics (mimics analog VCO imperfections):
+    // tanh((sin(2 pi p) + 0.15 * sin(6 pi p)) * 1.3), the 3rd harmonic at 15%
+    // amplitude for richer character, soft clipped to stay within ±1.0.
+    // One cycle is tabulated (SharedTables::Type::MODIFIED_SINE_CYCLE)
+    return modifiedSineTable->lookup(lfoPhase);
 }
 
 float RingModulator::generateTriangle()
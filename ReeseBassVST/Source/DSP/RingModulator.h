@@ -1,8 +1,10 @@
 #pragma once
 
-#include <juce_core/juce_core.h>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <random>
+#include "SharedTables.h"
 
 /**
  * RingModulator - Sub-Audio Ring Modulator
@@ -68,11 +70,22 @@ public:
      */
     void setWaveShape(WaveShape shape);
 
+    /**
+     * Current LFO output without advancing the phase (modulation source)
+     * @return Bipolar LFO value (-1.0 to +1.0)
+     */
+    float getLfoValue();
+
     /**
      * Reset internal state
      */
     void reset();
 
+    /**
+     * Reseed the chaos source (until then it uses a fixed seed)
+     */
+    void seed(std::uint32_t value);
+
 private:
     // Sample rate
     double sampleRate = 44100.0;
@@ -88,6 +101,10 @@ private:
     std::uniform_real_distribution<float> distribution;
     float phaseOffset = 0.0f;       // Random phase offset per cycle
 
+    // Shared waveform tables (acquired in the first prepare())
+    SharedTables::Handle sineTable;
+    SharedTables::Handle modifiedSineTable;
+
     // Generate LFO output for current phase
     float generateLFO();
 
@@ -0,0 +1,103 @@
+#include "SharedTables.h"
+#include <array>
+#include <mutex>
+#include <numbers>
+
+LookupTable::LookupTable(double newMinInput, double maxInput, int numIntervals, double (*function)(double))
+    : minInput(static_cast<float>(newMinInput)),
+      scale(static_cast<float>(numIntervals / (maxInput - newMinInput))),
+      maxPosition(static_cast<float>(numIntervals))
+{
+    points.resize(2 * (static_cast<size_t>(numIntervals) + 2));
+
+    const double step = (maxInput - newMinInput) / numIntervals;
+    const double delta = step * 1.0e-3;   // Central difference for the slope
+
+    for (int i = 0; i <= numIntervals; ++i)
+    {
+        const double x = newMinInput + i * step;
+        const double slope = (function(x + delta) - function(x - delta)) / (2.0 * delta);
+
+        points[2 * static_cast<size_t>(i)] = static_cast<float>(function(x));
+        points[2 * static_cast<size_t>(i) + 1] = static_cast<float>(slope * step);
+    }
+
+    // Read (with a zero fraction) when the input clamps to maxInput
+    points[points.size() - 2] = points[points.size() - 4];
+    points[points.size() - 1] = points[points.size() - 3];
+}
+
+//==============================================================================
+namespace
+{
+    constexpr double pi = std::numbers::pi;
+
+    double hyperbolicTangent(double x) { return std::tanh(x); }
+    double tanPrewarp(double normalizedFrequency) { return std::tan(pi * normalizedFrequency); }
+    double sineCycle(double phase) { return std::sin(2.0 * pi * phase); }
+    double decibelsToGain(double decibels) { return std::pow(10.0, decibels / 20.0); }
+
+    double modifiedSineCycle(double phase)
+    {
+        // Fundamental plus 15% third harmonic, soft clipped (RingModulator)
+        return std::tanh((std::sin(2.0 * pi * phase) + 0.15 * std::sin(6.0 * pi * phase)) * 1.3);
+    }
+
+    std::unique_ptr<LookupTable> build(SharedTables::Type type)
+    {
+        using Type = SharedTables::Type;
+
+        switch (type)
+        {
+            // Power-of-two scales where the range starts away from zero, so the index is exact
+            case Type::TANH:                return std::make_unique<LookupTable>(0.0, 16.0, 1024, hyperbolicTangent);
+            case Type::TAN_PREWARP:         return std::make_unique<LookupTable>(0.0, 0.49, 2048, tanPrewarp);
+            case Type::SINE_CYCLE:          return std::make_unique<LookupTable>(0.0, 1.0, 1024, sineCycle);
+            case Type::MODIFIED_SINE_CYCLE: return std::make_unique<LookupTable>(0.0, 1.0, 2048, modifiedSineCycle);
+            case Type::DECIBELS_TO_GAIN:    return std::make_unique<LookupTable>(-100.0, 24.0, 992, decibelsToGain);
+            case Type::NUM_TYPES:           break;
+        }
+
+        return nullptr;
+    }
+
+    constexpr auto numTypes = static_cast<size_t>(SharedTables::Type::NUM_TYPES);
+
+    // Weak references: the instances' handles own the tables
+    struct Registry
+    {
+        std::mutex mutex;
+        std::array<std::weak_ptr<const LookupTable>, numTypes> tables;
+    };
+
+    Registry& getRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+}
+
+//==============================================================================
+SharedTables::Handle SharedTables::acquire(Type type)
+{
+    auto& registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+
+    auto& entry = registry.tables[static_cast<size_t>(type)];
+
+    if (auto table = entry.lock())
+        return table;
+
+    Handle table = build(type);
+    entry = table;
+    return table;
+}
+
+int SharedTables::getNumLiveTables()
+{
+    auto& registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+
+    return static_cast<int>(std::count_if(registry.tables.begin(), registry.tables.end(),
+                                          [](const auto& table) { return !table.expired(); }));
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * LookupTable - Cubic Hermite Interpolated Function Samples
+ *
+ * f(x) and its slope sampled on a uniform grid over [minInput, maxInput],
+ * computed in double precision and stored interleaved, so one lookup reads
+ * one or two adjacent cache lines. Inputs outside the range (and NaN) clamp
+ * to the ends. Immutable after construction, so any number of threads can
+ * read it.
+ */
+class LookupTable
+{
+public:
+    LookupTable(double minInput, double maxInput, int numIntervals, double (*function)(double));
+
+    float lookup(float input) const noexcept
+    {
+        // max(0, NaN) is 0, so NaN reads the first entry instead of indexing out of range
+        const float position = std::min(maxPosition, std::max(0.0f, (input - minInput) * scale));
+        const auto index = static_cast<size_t>(position);
+        const float t = position - static_cast<float>(index);
+
+        // Value and slope (per interval) at both ends of the interval
+        const float* point = points.data() + 2 * index;
+        const float y0 = point[0], m0 = point[1], y1 = point[2], m1 = point[3];
+        const float rise = y1 - y0;
+
+        return y0 + t * (m0 + t * ((3.0f * rise - 2.0f * m0 - m1) + t * (m0 + m1 - 2.0f * rise)));
+    }
+
+    /**
+     * For odd functions tabulated from 0: f(-x) = -f(x)
+     */
+    float lookupOdd(float input) const noexcept
+    {
+        return std::copysign(lookup(std::abs(input)), input);
+    }
+
+    size_t getSizeInBytes() const noexcept { return points.size() * sizeof(float); }
+
+private:
+    float minInput;
+    float scale;         // Intervals per unit input
+    float maxPosition;   // numIntervals
+    std::vector<float> points;   // (value, slope) of numIntervals + 1 points and a guard copy of the last
+};
+
+/**
+ * SharedTables - Process-Wide, Reference-Counted Lookup Tables
+ *
+ * Every instance of the plugin needs the same approximation tables, so they
+ * are built once per process and shared read-only: 300 instances read one
+ * copy from L2/L3 instead of each keeping its own.
+ *
+ * acquire() returns the live table of a type, building it if no instance
+ * holds one; the table is freed when the last handle goes. Modules acquire
+ * in their first prepare() (the processor's prepareToPlay), never on the
+ * audio thread, and keep the handle across later prepares.
+ *
+ * Tables are indexed by normalized frequency or phase rather than Hz, so
+ * one copy serves every sample rate, including the oversampled offline
+ * profiles that are switched to on the audio thread.
+ *
+ * Interpolation error is below float resolution (the error is dominated by
+ * rounding the input), so results match the library functions to about
+ * 1e-7. 8-16KB per table.
+ */
+namespace SharedTables
+{
+    enum class Type
+    {
+        TANH,                 // tanh(x), x in [0, 16] (lookupOdd; 1 beyond)
+        TAN_PREWARP,          // tan(pi * f / fs), normalized frequency in [0, 0.49]
+        SINE_CYCLE,           // sin(2 pi p), phase in [0, 1]
+        MODIFIED_SINE_CYCLE,  // RingModulator's modified sine, phase in [0, 1]
+        DECIBELS_TO_GAIN,     // 10^(dB / 20), dB in [-100, 24]
+        NUM_TYPES
+    };
+
+    using Handle = std::shared_ptr<const LookupTable>;
+
+    /**
+     * The shared table of a type (locks and may allocate: not on the audio thread)
+     */
+    Handle acquire(Type type);
+
+    /**
+     * Tables currently alive in the process (for tests and benchmarks)
+     */
+    int getNumLiveTables();
+}
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX__)
+ #include <immintrin.h>
+ #define REESE_SIMD_AVX 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <emmintrin.h>
+ #define REESE_SIMD_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+ #include <arm_neon.h>
+ #define REESE_SIMD_NEON 1
+#endif
+
+/**
+ * SimdVector - Minimal Portable SIMD Float Vectors
+ *
+ * Fixed-width float vectors over the instruction sets the build targets:
+ * - SimdVector<4>: SSE2 / NEON register, or 4 scalar lanes
+ * - SimdVector<8>: AVX register (when compiled with -mavx/-mavx2),
+ *                  otherwise a pair of SimdVector<4>
+ * - SimdFloat:     the widest native vector (8 lanes with AVX, else 4)
+ *
+ * Fixed widths let filter banks pack a known number of independent filters
+ * (bands x channels, or independent instances) into lanes; SimdFloat is for
+ * straight-line array kernels. Only the operations the DSP kernels need are
+ * provided. Loads and stores are unaligned. Comparisons return lane masks
+ * (all bits set or clear) for select().
+ */
+template <int Lanes>
+struct SimdVector;
+
+//==============================================================================
+template <>
+struct SimdVector<4>
+{
+#if REESE_SIMD_SSE
+    using Native = __m128;
+#elif REESE_SIMD_NEON
+    using Native = float32x4_t;
+#else
+    struct Native { float v[4]; };
+#endif
+
+    static constexpr int width = 4;
+    static constexpr std::size_t alignment = 16;
+
+    Native value;
+
+    static SimdVector load(const float* source) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_loadu_ps(source) };
+#elif REESE_SIMD_NEON
+        return { vld1q_f32(source) };
+#else
+        SimdVector r;
+        for (int i = 0; i < width; ++i) r.value.v[i] = source[i];
+        return r;
+#endif
+    }
+
+    void store(float* destination) const noexcept
+    {
+#if REESE_SIMD_SSE
+        _mm_storeu_ps(destination, value);
+#elif REESE_SIMD_NEON
+        vst1q_f32(destination, value);
+#else
+        for (int i = 0; i < width; ++i) destination[i] = value.v[i];
+#endif
+    }
+
+    static SimdVector broadcast(float scalar) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_set1_ps(scalar) };
+#elif REESE_SIMD_NEON
+        return { vdupq_n_f32(scalar) };
+#else
+        SimdVector r;
+        for (int i = 0; i < width; ++i) r.value.v[i] = scalar;
+        return r;
+#endif
+    }
+
+    friend SimdVector operator+(SimdVector a, SimdVector b) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_add_ps(a.value, b.value) };
+#elif REESE_SIMD_NEON
+        return { vaddq_f32(a.value, b.value) };
+#else
+        for (int i = 0; i < width; ++i) a.value.v[i] += b.value.v[i];
+        return a;
+#endif
+    }
+
+    friend SimdVector operator-(SimdVector a, SimdVector b) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_sub_ps(a.value, b.value) };
+#elif REESE_SIMD_NEON
+        return { vsubq_f32(a.value, b.value) };
+#else
+        for (int i = 0; i < width; ++i) a.value.v[i] -= b.value.v[i];
+        return a;
+#endif
+    }
+
+    friend SimdVector operator*(SimdVector a, SimdVector b) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_mul_ps(a.value, b.value) };
+#elif REESE_SIMD_NEON
+        return { vmulq_f32(a.value, b.value) };
+#else
+        for (int i = 0; i < width; ++i) a.value.v[i] *= b.value.v[i];
+        return a;
+#endif
+    }
+
+    friend SimdVector operator/(SimdVector a, SimdVector b) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_div_ps(a.value, b.value) };
+#elif REESE_SIMD_NEON && defined(__aarch64__)
+        return { vdivq_f32(a.value, b.value) };
+#else
+        alignas(alignment) float x[width], y[width];
+        a.store(x);
+        b.store(y);
+        for (int i = 0; i < width; ++i) x[i] /= y[i];
+        return load(x);
+#endif
+    }
+
+    static SimdVector min(SimdVector a, SimdVector b) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_min_ps(a.value, b.value) };
+#elif REESE_SIMD_NEON
+        return { vminq_f32(a.value, b.value) };
+#else
+        for (int i = 0; i < width; ++i) a.value.v[i] = b.value.v[i] < a.value.v[i] ? b.value.v[i] : a.value.v[i];
+        return a;
+#endif
+    }
+
+    static SimdVector max(SimdVector a, SimdVector b) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_max_ps(a.value, b.value) };
+#elif REESE_SIMD_NEON
+        return { vmaxq_f32(a.value, b.value) };
+#else
+        for (int i = 0; i < width; ++i) a.value.v[i] = a.value.v[i] < b.value.v[i] ? b.value.v[i] : a.value.v[i];
+        return a;
+#endif
+    }
+
+    static SimdVector abs(SimdVector a) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.value) };
+#elif REESE_SIMD_NEON
+        return { vabsq_f32(a.value) };
+#else
+        for (int i = 0; i < width; ++i) a.value.v[i] = std::abs(a.value.v[i]);
+        return a;
+#endif
+    }
+
+    /** Lane mask of a < b */
+    static SimdVector lessThan(SimdVector a, SimdVector b) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_cmplt_ps(a.value, b.value) };
+#elif REESE_SIMD_NEON
+        return { vreinterpretq_f32_u32(vcltq_f32(a.value, b.value)) };
+#else
+        for (int i = 0; i < width; ++i) a.value.v[i] = std::bit_cast<float>(a.value.v[i] < b.value.v[i] ? ~0u : 0u);
+        return a;
+#endif
+    }
+
+    /** Lane mask of a > b */
+    static SimdVector greaterThan(SimdVector a, SimdVector b) noexcept
+    {
+        return lessThan(b, a);
+    }
+
+    /** Per lane: mask set ? ifTrue : ifFalse */
+    static SimdVector select(SimdVector mask, SimdVector ifTrue, SimdVector ifFalse) noexcept
+    {
+#if REESE_SIMD_SSE
+        return { _mm_or_ps(_mm_and_ps(mask.value, ifTrue.value), _mm_andnot_ps(mask.value, ifFalse.value)) };
+#elif REESE_SIMD_NEON
+        return { vbslq_f32(vreinterpretq_u32_f32(mask.value), ifTrue.value, ifFalse.value) };
+#else
+        for (int i = 0; i < width; ++i)
+            ifFalse.value.v[i] = std::bit_cast<std::uint32_t>(mask.value.v[i]) != 0 ? ifTrue.value.v[i] : ifFalse.value.v[i];
+        return ifFalse;
+#endif
+    }
+};
+
+//==============================================================================
+template <>
+struct SimdVector<8>
+{
+#if REESE_SIMD_AVX
+    using Native = __m256;
+#else
+    struct Native { SimdVector<4> low, high; };
+#endif
+
+    static constexpr int width = 8;
+    static constexpr std::size_t alignment = 32;
+
+    Native value;
+
+#if REESE_SIMD_AVX
+    static SimdVector load(const float* source) noexcept                 { return { _mm256_loadu_ps(source) }; }
+    void store(float* destination) const noexcept                         { _mm256_storeu_ps(destination, value); }
+    static SimdVector broadcast(float scalar) noexcept                    { return { _mm256_set1_ps(scalar) }; }
+    friend SimdVector operator+(SimdVector a, SimdVector b) noexcept      { return { _mm256_add_ps(a.value, b.value) }; }
+    friend SimdVector operator-(SimdVector a, SimdVector b) noexcept      { return { _mm256_sub_ps(a.value, b.value) }; }
+    friend SimdVector operator*(SimdVector a, SimdVector b) noexcept      { return { _mm256_mul_ps(a.value, b.value) }; }
+    friend SimdVector operator/(SimdVector a, SimdVector b) noexcept      { return { _mm256_div_ps(a.value, b.value) }; }
+    static SimdVector min(SimdVector a, SimdVector b) noexcept            { return { _mm256_min_ps(a.value, b.value) }; }
+    static SimdVector max(SimdVector a, SimdVector b) noexcept            { return { _mm256_max_ps(a.value, b.value) }; }
+    static SimdVector abs(SimdVector a) noexcept                          { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.value) }; }
+    static SimdVector lessThan(SimdVector a, SimdVector b) noexcept       { return { _mm256_cmp_ps(a.value, b.value, _CMP_LT_OQ) }; }
+    static SimdVector greaterThan(SimdVector a, SimdVector b) noexcept    { return { _mm256_cmp_ps(a.value, b.value, _CMP_GT_OQ) }; }
+    static SimdVector select(SimdVector m, SimdVector t, SimdVector f) noexcept { return { _mm256_blendv_ps(f.value, t.value, m.value) }; }
+#else
+    using Half = SimdVector<4>;
+
+    static SimdVector load(const float* source) noexcept                 { return { { Half::load(source), Half::load(source + 4) } }; }
+    void store(float* destination) const noexcept                         { value.low.store(destination); value.high.store(destination + 4); }
+    static SimdVector broadcast(float scalar) noexcept                    { return { { Half::broadcast(scalar), Half::broadcast(scalar) } }; }
+    friend SimdVector operator+(SimdVector a, SimdVector b) noexcept      { return { { a.value.low + b.value.low, a.value.high + b.value.high } }; }
+    friend SimdVector operator-(SimdVector a, SimdVector b) noexcept      { return { { a.value.low - b.value.low, a.value.high - b.value.high } }; }
+    friend SimdVector operator*(SimdVector a, SimdVector b) noexcept      { return { { a.value.low * b.value.low, a.value.high * b.value.high } }; }
+    friend SimdVector operator/(SimdVector a, SimdVector b) noexcept      { return { { a.value.low / b.value.low, a.value.high / b.value.high } }; }
+    static SimdVector min(SimdVector a, SimdVector b) noexcept            { return { { Half::min(a.value.low, b.value.low), Half::min(a.value.high, b.value.high) } }; }
+    static SimdVector max(SimdVector a, SimdVector b) noexcept            { return { { Half::max(a.value.low, b.value.low), Half::max(a.value.high, b.value.high) } }; }
+    static SimdVector abs(SimdVector a) noexcept                          { return { { Half::abs(a.value.low), Half::abs(a.value.high) } }; }
+    static SimdVector lessThan(SimdVector a, SimdVector b) noexcept       { return { { Half::lessThan(a.value.low, b.value.low), Half::lessThan(a.value.high, b.value.high) } }; }
+    static SimdVector greaterThan(SimdVector a, SimdVector b) noexcept    { return { { Half::greaterThan(a.value.low, b.value.low), Half::greaterThan(a.value.high, b.value.high) } }; }
+    static SimdVector select(SimdVector m, SimdVector t, SimdVector f) noexcept { return { { Half::select(m.value.low, t.value.low, f.value.low), Half::select(m.value.high, t.value.high, f.value.high) } }; }
+#endif
+};
+
+//==============================================================================
+// Operations shared by every width
+
+template <int Lanes>
+SimdVector<Lanes>& operator+=(SimdVector<Lanes>& a, SimdVector<Lanes> b) noexcept { return a = a + b; }
+
+template <int Lanes>
+SimdVector<Lanes>& operator-=(SimdVector<Lanes>& a, SimdVector<Lanes> b) noexcept { return a = a - b; }
+
+template <int Lanes>
+SimdVector<Lanes>& operator*=(SimdVector<Lanes>& a, SimdVector<Lanes> b) noexcept { return a = a * b; }
+
+/** Horizontal maximum of all lanes */
+template <int Lanes>
+float maxElement(SimdVector<Lanes> v) noexcept
+{
+    alignas(32) float lanes[Lanes];
+    v.store(lanes);
+
+    float result = lanes[0];
+    for (int i = 1; i < Lanes; ++i)
+        result = lanes[i] > result ? lanes[i] : result;
+
+    return result;
+}
+
+/** Horizontal sum of all lanes */
+template <int Lanes>
+float sumElements(SimdVector<Lanes> v) noexcept
+{
+    alignas(32) float lanes[Lanes];
+    v.store(lanes);
+
+    float result = 0.0f;
+    for (int i = 0; i < Lanes; ++i)
+        result += lanes[i];
+
+    return result;
+}
+
+//==============================================================================
+#if REESE_SIMD_AVX
+using SimdFloat = SimdVector<8>;
+#else
+using SimdFloat = SimdVector<4>;
+#endif
@@ -7,6 +7,14 @@ StateVariableFilter::StateVariableFilter()
 void StateVariableFilter::prepare(double newSampleRate)
 {
     sampleRate = newSampleRate;
+
+    if (prewarpTable == nullptr)
+    {
+        prewarpTable = SharedTables::acquire(SharedTables::Type::TAN_PREWARP);
+        tanhTable = SharedTables::acquire(SharedTables::Type::TANH);
+    }
+
+    needsUpdate = true;   // The sample rate changed
     reset();
     updateCoefficients();
 }
@@ -17,9 +25,14 @@ void StateVariableFilter::reset()
     ic2eq = 0.0f;
 }
 
+bool StateVariableFilter::hasStateOf(const StateVariableFilter& other, float tolerance) const noexcept
+{
+    return std::abs(ic1eq - other.ic1eq) <= tolerance && std::abs(ic2eq - other.ic2eq) <= tolerance;
+}
+
 void StateVariableFilter::setCutoff(float hz)
 {
-    hz = juce::jlimit(20.0f, 20000.0f, hz);
+    hz = std::clamp(hz, 20.0f, 20000.0f);
 
     if (std::abs(cutoffFreq - hz) > 0.01f)
     {
@@ -30,7 +43,7 @@ void StateVariableFilter::setCutoff(float hz)
 
 void StateVariableFilter::setResonance(float res)
 {
-    res = juce::jlimit(0.0f, 0.95f, res);
+    res = std::clamp(res, 0.0f, 0.95f);
 
     if (std::abs(resonance - res) > 0.001f)
     {
@@ -41,7 +54,7 @@ void StateVariableFilter::setResonance(float res)
 
 void StateVariableFilter::setDrive(float drv)
 {
-    drive = juce::jlimit(0.0f, 2.0f, drv);
+    drive = std::clamp(drv, 0.0f, 2.0f);
 }
 
 void StateVariableFilter::updateCoefficients()
@@ -50,13 +63,8 @@ void StateVariableFilter::updateCoefficients()
         return;
 
     // Frequency warping for better analog matching
-    // Uses bilinear transform pre-warping
-    float wd = 2.0f * juce::MathConstants<float>::pi * cutoffFreq;
-    float T = 1.0f / static_cast<float>(sampleRate);
-    float wa = (2.0f / T) * std::tan(wd * T / 2.0f);
-
-    // Calculate g coefficient (cutoff)
-    g = wa * T / 2.0f;
+    // Uses bilinear transform pre-warping: g = wa * T / 2 = tan(wd * T / 2) = tan(pi * fc / fs)
+    g = prewarpTable->lookup(cutoffFreq / static_cast<float>(sampleRate));
 
     // Calculate k coefficient (damping/resonance)
     // Convert resonance (0.0-0.95) to Q (0.5-20)
@@ -71,7 +79,7 @@ float StateVariableFilter::saturateInput(float x)
 {
     // Soft clip using tanh to mimic op-amp saturation
     // This adds analog character and prevents filter instability
-    return std::tanh(x * 1.5f) / 1.5f;
+    return tanhTable->lookupOdd(x * 1.5f) / 1.5f;
 }
 
 StateVariableFilter::FilterOutput StateVariableFilter::processSample(float input)
@@ -87,8 +95,8 @@ StateVariableFilter::FilterOutput StateVariableFilter::processSample(float input
     // State variable filter algorithm (trapezoidal integration)
     // Based on Vadim Zavalishin's "The Art of VA Filter Design"
 
-    // Compute high-pass output
-    float hp = (input - ic1eq * k - ic2eq) / (1.0f + g * k + g * g);
+    // Compute high-pass output (both integrator states feed back through g)
+    float hp = (input - (k + g) * ic1eq - ic2eq) / (1.0f + g * k + g * g);
 
     // Compute band-pass output (first integrator)
     float bp = g * hp + ic1eq;
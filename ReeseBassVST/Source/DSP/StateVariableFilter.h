@@ -1,7 +1,8 @@
 #pragma once
 
-#include <juce_core/juce_core.h>
+#include <algorithm>
 #include <cmath>
+#include "SharedTables.h"
 
 /**
  * StateVariableFilter - Resonant State Variable Filter
@@ -69,6 +70,11 @@ public:
      */
     void reset();
 
+    /**
+     * Integrator states within tolerance of another filter's
+     */
+    bool hasStateOf(const StateVariableFilter& other, float tolerance) const noexcept;
+
 private:
     // Sample rate
     double sampleRate = 44100.0;
@@ -89,6 +95,10 @@ private:
     // Coefficient update flag
     bool needsUpdate = true;
 
+    // Shared tables (acquired in the first prepare())
+    SharedTables::Handle prewarpTable;
+    SharedTables::Handle tanhTable;
+
     /**
      * Update filter coefficients when parameters change
      */
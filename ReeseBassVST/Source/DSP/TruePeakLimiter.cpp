@@ -0,0 +1,266 @@
+#include "TruePeakLimiter.h"
+#include <numbers>
+
+TruePeakLimiter::TruePeakLimiter()
+{
+    designInterpolator();
+}
+
+void TruePeakLimiter::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+
+    // Size everything for the longest lookahead so setLookahead() never allocates
+    const int maxWindow = static_cast<int>(std::ceil(maxLookaheadMs * 0.001 * sampleRate)) + 1;
+
+    for (auto& line : delayLines)
+        line.assign(static_cast<size_t>(maxWindow + interpolatorDelay), 0.0f);
+
+    peakRing.assign(static_cast<size_t>(maxWindow), 0.0f);
+    dequeIndices.assign(static_cast<size_t>(maxWindow), 0);
+    averageRing.assign(static_cast<size_t>(maxWindow), 1.0f);
+
+    setRelease(80.0f);
+    configure();
+    reset();
+}
+
+void TruePeakLimiter::setLookahead(float ms)
+{
+    ms = std::clamp(ms, 0.1f, maxLookaheadMs);
+
+    if (std::abs(lookaheadMs - ms) > 0.001f)
+    {
+        lookaheadMs = ms;
+        configure();
+    }
+}
+
+void TruePeakLimiter::setCeiling(float db)
+{
+    ceiling = std::pow(10.0f, std::clamp(db, -24.0f, 0.0f) / 20.0f);
+}
+
+void TruePeakLimiter::setRelease(float ms)
+{
+    const double releaseSamples = std::max(1.0, static_cast<double>(ms) * 0.001 * sampleRate);
+    releaseCoeff = static_cast<float>(std::exp(-1.0 / releaseSamples));
+}
+
+void TruePeakLimiter::configure()
+{
+    const int maxWindow = static_cast<int>(peakRing.size());
+    const int samples = std::clamp(static_cast<int>(std::lround(lookaheadMs * 0.001 * sampleRate)), 1, std::max(1, maxWindow - 1));
+
+    if (samples == lookaheadSamples && maxWindow > 0)
+        return;
+
+    lookaheadSamples = samples;
+    delayLength = lookaheadSamples + interpolatorDelay;
+    rebuildWindow();
+}
+
+void TruePeakLimiter::rebuildWindow()
+{
+    // The rings keep the last maxWindow peaks and gains, so the new window is
+    // rebuilt from them (slots before the first sample hold the reset values)
+    const int ringSize = static_cast<int>(peakRing.size());
+    if (ringSize == 0)
+        return;
+
+    const int window = lookaheadSamples + 1;
+
+    dequeHead = 0;
+    dequeSize = 0;
+    averageSum = 0.0;
+
+    for (std::int64_t index = sampleCounter - window; index < sampleCounter; ++index)
+    {
+        const auto slot = static_cast<size_t>((index + ringSize) % ringSize);
+        averageSum += static_cast<double>(averageRing[slot]);
+
+        if (index < 0)
+            continue;
+
+        while (dequeSize > 0
+               && peakRing[static_cast<size_t>(dequeIndices[static_cast<size_t>(dequeSize - 1)] % ringSize)] <= peakRing[slot])
+            --dequeSize;
+
+        dequeIndices[static_cast<size_t>(dequeSize++)] = index;
+    }
+}
+
+void TruePeakLimiter::reset()
+{
+    for (auto& channelHistory : history)
+        channelHistory.fill(0.0f);
+
+    for (auto& line : delayLines)
+        std::fill(line.begin(), line.end(), 0.0f);
+
+    std::fill(peakRing.begin(), peakRing.end(), 0.0f);
+    std::fill(averageRing.begin(), averageRing.end(), 1.0f);
+
+    delayPosition = 0;
+    dequeHead = 0;
+    dequeSize = 0;
+    sampleCounter = 0;
+    releaseEnvelope = 1.0f;
+    averageSum = static_cast<double>(lookaheadSamples + 1);
+}
+
+//==============================================================================
+void TruePeakLimiter::designInterpolator()
+{
+    // Hann-windowed sinc, phase p estimates x(n - interpolatorDelay + p/4).
+    // Phase 0 is a unit impulse, so the sample itself is always included.
+    const float halfWidth = static_cast<float>(tapsPerPhase) * 0.5f + 0.5f;
+    alignas(16) float coefficients[tapsPerPhase][oversampling];
+
+    for (int phase = 0; phase < oversampling; ++phase)
+    {
+        const float fraction = static_cast<float>(phase) / static_cast<float>(oversampling);
+        float sum = 0.0f;
+
+        for (int t = 0; t < tapsPerPhase; ++t)
+        {
+            const float u = static_cast<float>(t - interpolatorDelay) + fraction;
+            const float sinc = std::abs(u) < 1.0e-6f ? 1.0f
+                             : std::sin(std::numbers::pi_v<float> * u) / (std::numbers::pi_v<float> * u);
+            const float window = 0.5f + 0.5f * std::cos(std::numbers::pi_v<float> * u / halfWidth);
+
+            coefficients[t][phase] = sinc * window;
+            sum += coefficients[t][phase];
+        }
+
+        // Unity DC gain per phase
+        for (int t = 0; t < tapsPerPhase; ++t)
+            coefficients[t][phase] /= sum;
+    }
+
+    for (int t = 0; t < tapsPerPhase; ++t)
+        taps[static_cast<size_t>(t)] = Vec::load(coefficients[t]);
+}
+
+//==============================================================================
+void TruePeakLimiter::process(float* const* channels, int numChannels, int numSamples)
+{
+    numChannels = std::min(numChannels, maxChannels);
+
+    if (numChannels <= 0 || delayLines[0].empty())
+        return;
+
+    for (int offset = 0; offset < numSamples; offset += chunkSize)
+        processChunk(channels, numChannels, offset, std::min(chunkSize, numSamples - offset));
+}
+
+void TruePeakLimiter::processChunk(float* const* channels, int numChannels, int offset, int numSamples)
+{
+    constexpr int historyLength = tapsPerPhase - 1;
+
+    // Append the chunk behind the interpolator history
+    for (int channel = 0; channel < numChannels; ++channel)
+        std::copy(channels[channel] + offset, channels[channel] + offset + numSamples,
+                  history[static_cast<size_t>(channel)].begin() + historyLength);
+
+    detectPeaks(numChannels, numSamples);
+    computeGains(numSamples);
+
+    // Delay the audio and apply the gain
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto& line = delayLines[static_cast<size_t>(channel)];
+        float* data = channels[channel] + offset;
+        const int lineSize = static_cast<int>(line.size());
+        int position = delayPosition;
+        int readPosition = position >= delayLength ? position - delayLength : position - delayLength + lineSize;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            line[static_cast<size_t>(position)] = data[i];
+            data[i] = line[static_cast<size_t>(readPosition)] * gains[static_cast<size_t>(i)];
+
+            if (++position == lineSize)
+                position = 0;
+            if (++readPosition == lineSize)
+                readPosition = 0;
+        }
+
+        // Keep the last samples as history for the next chunk
+        auto& channelHistory = history[static_cast<size_t>(channel)];
+        std::copy(channelHistory.begin() + numSamples, channelHistory.begin() + numSamples + historyLength,
+                  channelHistory.begin());
+    }
+
+    delayPosition = (delayPosition + numSamples) % static_cast<int>(delayLines[0].size());
+}
+
+void TruePeakLimiter::detectPeaks(int numChannels, int numSamples)
+{
+    constexpr int historyLength = tapsPerPhase - 1;
+
+    std::fill(peaks.begin(), peaks.begin() + numSamples, 0.0f);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const float* x = history[static_cast<size_t>(channel)].data() + historyLength;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // All four phases at once: lane p = interpolated value at fraction p/4
+            auto acc = taps[0] * Vec::broadcast(x[i]);
+            for (int t = 1; t < tapsPerPhase; ++t)
+                acc += taps[static_cast<size_t>(t)] * Vec::broadcast(x[i - t]);
+
+            auto& peak = peaks[static_cast<size_t>(i)];
+            peak = std::max(peak, maxElement(Vec::abs(acc)));
+        }
+    }
+}
+
+void TruePeakLimiter::computeGains(int numSamples)
+{
+    const int window = lookaheadSamples + 1;
+    const int ringSize = static_cast<int>(peakRing.size());
+    const double inverseWindow = 1.0 / static_cast<double>(window);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float peak = peaks[static_cast<size_t>(i)];
+        const std::int64_t index = sampleCounter++;
+
+        // Sliding-window maximum: expire the front, then drop smaller entries from the back
+        if (dequeSize > 0 && dequeIndices[static_cast<size_t>(dequeHead)] <= index - window)
+        {
+            dequeHead = (dequeHead + 1) % ringSize;
+            --dequeSize;
+        }
+
+        while (dequeSize > 0)
+        {
+            const int back = (dequeHead + dequeSize - 1) % ringSize;
+            if (peakRing[static_cast<size_t>(dequeIndices[static_cast<size_t>(back)] % ringSize)] > peak)
+                break;
+            --dequeSize;
+        }
+
+        peakRing[static_cast<size_t>(index % ringSize)] = peak;
+        dequeIndices[static_cast<size_t>((dequeHead + dequeSize) % ringSize)] = index;
+        ++dequeSize;
+
+        const float windowPeak = peakRing[static_cast<size_t>(dequeIndices[static_cast<size_t>(dequeHead)] % ringSize)];
+        const float target = windowPeak > ceiling ? ceiling / windowPeak : 1.0f;
+
+        // Instant attack, one-pole release (the envelope never exceeds the target)
+        releaseEnvelope = target < releaseEnvelope ? target
+                                                   : target + releaseCoeff * (releaseEnvelope - target);
+
+        // Moving average over the lookahead window (the slot window samples back
+        // leaves; it is the current slot itself when the window spans the ring)
+        const auto leaving = static_cast<size_t>((index - window + ringSize) % ringSize);
+        averageSum += static_cast<double>(releaseEnvelope) - static_cast<double>(averageRing[leaving]);
+        averageRing[static_cast<size_t>(index % ringSize)] = releaseEnvelope;
+
+        gains[static_cast<size_t>(i)] = static_cast<float>(averageSum * inverseWindow);
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <array>
+#include <vector>
+#include "SimdFloat.h"
+
+/**
+ * TruePeakLimiter - Lookahead Brickwall Limiter with Inter-Sample Peak Detection
+ *
+ * Block-based output limiter, linked across channels:
+ *
+ * 1. True-peak detection: a 4x polyphase windowed-sinc interpolator estimates
+ *    the signal between samples. The four phases sit in the four lanes of one
+ *    SimdVector<4>, so each input sample costs 12 vector multiply-adds per
+ *    channel. As with BS.1770 4x meters, peaks near Nyquist can still fall
+ *    between phases, so expect up to ~0.2dB of overshoot there.
+ * 2. Sliding-window maximum of the peaks over the lookahead window
+ *    (monotonic deque, O(1) amortized per sample).
+ * 3. Gain computer: g = min(1, ceiling / windowPeak), then instant attack
+ *    and one-pole release.
+ * 4. Moving average over the lookahead window. Every value averaged is
+ *    already at or below the gain needed for the delayed peak, so the gain
+ *    ramps down smoothly and still reaches that value in time.
+ * 5. Delay the audio by the lookahead (plus the interpolator delay) and
+ *    apply the gain.
+ *
+ * Latency = lookahead + interpolatorDelay samples (report it to the host).
+ * Buffers are sized in prepare() for the longest lookahead; processing never
+ * allocates, and blocks of any length are handled in fixed internal chunks.
+ */
+class TruePeakLimiter
+{
+public:
+    static constexpr int maxChannels = 2;
+    static constexpr float maxLookaheadMs = 5.0f;
+
+    TruePeakLimiter();
+
+    /**
+     * Prepare the module for processing (allocates the delay lines)
+     * @param sampleRate The sample rate in Hz
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * Limit a block in place
+     * @param channels Channel pointers
+     * @param numChannels Number of channels (up to maxChannels, gain is linked)
+     * @param numSamples Block length
+     */
+    void process(float* const* channels, int numChannels, int numSamples);
+
+    /**
+     * Set the lookahead time (changes the latency). Safe while running: the
+     * delay read tap and the window move, the audio and gain history stay
+     * @param ms Lookahead in milliseconds (0.1-5.0ms)
+     */
+    void setLookahead(float ms);
+
+    /**
+     * Set the output ceiling
+     * @param db Maximum true-peak level in dBFS
+     */
+    void setCeiling(float db);
+
+    /**
+     * Set the release time
+     * @param ms Release time in milliseconds
+     */
+    void setRelease(float ms);
+
+    /**
+     * Processing latency in samples at the current lookahead
+     */
+    int getLatencySamples() const { return lookaheadSamples + interpolatorDelay; }
+
+    /**
+     * Latency at the longest lookahead (valid after prepare())
+     */
+    int getMaxLatencySamples() const { return static_cast<int>(peakRing.size()) - 1 + interpolatorDelay; }
+
+    /**
+     * Reset internal state
+     */
+    void reset();
+
+private:
+    using Vec = SimdVector<4>;
+
+    static constexpr int oversampling = 4;            // One phase per SIMD lane
+    static constexpr int tapsPerPhase = 12;
+    static constexpr int interpolatorDelay = tapsPerPhase / 2;
+    static constexpr int chunkSize = 256;
+
+    // Sample rate
+    double sampleRate = 44100.0;
+
+    // Parameters
+    float lookaheadMs = 1.5f;
+    int lookaheadSamples = 66;
+    float ceiling = 0.891f;          // -1 dBTP
+    float releaseCoeff = 0.999f;
+
+    // Interpolator coefficients: taps[t] holds tap t of all four phases
+    std::array<Vec, tapsPerPhase> taps;
+
+    // Per-channel input history for the interpolator, followed by the current chunk
+    std::array<std::array<float, tapsPerPhase - 1 + chunkSize>, maxChannels> history {};
+
+    // Audio delay lines, sized for the longest delay; read delayLength behind the write position
+    std::array<std::vector<float>, maxChannels> delayLines;
+    int delayLength = 1;
+    int delayPosition = 0;
+
+    // Sliding-window maximum (monotonic deque of sample indices into peakRing)
+    std::vector<float> peakRing;
+    std::vector<std::int64_t> dequeIndices;
+    int dequeHead = 0;
+    int dequeSize = 0;
+    std::int64_t sampleCounter = 0;
+
+    // Gain smoothing
+    float releaseEnvelope = 1.0f;
+    std::vector<float> averageRing;     // Indexed like peakRing
+    double averageSum = 0.0;
+
+    // Scratch (one chunk)
+    std::array<float, chunkSize> peaks {};
+    std::array<float, chunkSize> gains {};
+
+    void processChunk(float* const* channels, int numChannels, int offset, int numSamples);
+    void detectPeaks(int numChannels, int numSamples);
+    void computeGains(int numSamples);
+    void designInterpolator();
+    void configure();
+    void rebuildWindow();
+};
@@ -7,6 +7,10 @@ WaveShapers::WaveShapers()
 void WaveShapers::prepare(double newSampleRate)
 {
     sampleRate = newSampleRate;
+
+    if (tanhTable == nullptr)
+        tanhTable = SharedTables::acquire(SharedTables::Type::TANH);
+
     reset();
 }
 
@@ -17,7 +21,7 @@ void WaveShapers::reset()
 
 void WaveShapers::setDrive(float drv)
 {
-    drive = juce::jlimit(0.0f, 2.0f, drv);
+    drive = std::clamp(drv, 0.0f, 2.0f);
 }
 
 void WaveShapers::setSaturationType(SaturationType type)
@@ -27,7 +31,7 @@ void WaveShapers::setSaturationType(SaturationType type)
 
 void WaveShapers::setCharacter(float char_)
 {
-    character = juce::jlimit(0.0f, 1.0f, char_);
+    character = std::clamp(char_, 0.0f, 1.0f);
 }
 
 float WaveShapers::process(float input)
@@ -69,7 +73,7 @@ float WaveShapers::softClip(float input)
 {
     // Simple tanh soft clipping
     // Smooth, symmetric saturation
-    return std::tanh(input * 1.5f);
+    return lookupTanh(input * 1.5f);
 }
 
 float WaveShapers::diodeClipper(float input)
@@ -83,11 +87,11 @@ float WaveShapers::diodeClipper(float input)
 
     if (input > 0.0f)
     {
-        return Vf * std::tanh(input / (Eta * Vt));
+        return Vf * lookupTanh(input / (Eta * Vt));
     }
     else
     {
-        return -Vf * std::tanh(-input / (Eta * Vt));
+        return -Vf * lookupTanh(-input / (Eta * Vt));
     }
 }
 
@@ -100,12 +104,12 @@ float WaveShapers::asymmetricSaturation(float input)
     if (input > 0.0f)
     {
         // Positive half: harder saturation
-        return std::tanh(input * 1.8f);
+        return lookupTanh(input * 1.8f);
     }
     else
     {
         // Negative half: softer saturation
-        return std::tanh(input * 1.2f) * 0.9f;
+        return lookupTanh(input * 1.2f) * 0.9f;
     }
 }
 
@@ -116,13 +120,13 @@ float WaveShapers::multiStage(float input)
     float x = input;
 
     // Light soft clipping (adds warmth)
-    x = std::tanh(x * 1.5f) / 1.5f;
+    x = lookupTanh(x * 1.5f) / 1.5f;
 
     // Stage 2: Character-dependent saturation
     // character = 0.0: smooth (soft clip)
     // character = 1.0: aggressive (harder clip)
     float saturationAmount = 1.0f + (character * 2.0f); // 1.0 to 3.0
-    x = std::tanh(x * saturationAmount) / saturationAmount;
+    x = lookupTanh(x * saturationAmount) / saturationAmount;
 
     // Stage 3: Asymmetric clipping for harmonics
     if (character > 0.3f)
@@ -147,6 +151,6 @@ float WaveShapers::softClipWithThreshold(float input, float threshold)
     {
         float sign = (input > 0.0f) ? 1.0f : -1.0f;
         float excess = std::abs(input) - threshold;
-        return sign * (threshold + std::tanh(excess * 2.0f) * 0.3f);
+        return sign * (threshold + lookupTanh(excess * 2.0f) * 0.3f);
     }
 }
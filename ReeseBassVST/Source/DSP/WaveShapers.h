@@ -1,7 +1,8 @@
 #pragma once
 
-#include <juce_core/juce_core.h>
+#include <algorithm>
 #include <cmath>
+#include "SharedTables.h"
 
 /**
  * WaveShapers - Wave Shaping and Saturation Module
@@ -80,6 +81,11 @@ private:
     float outputGain = 0.7f;             // Output compensation
     SaturationType currentType = SaturationType::MULTI_STAGE;
 
+    // Shared tanh table (acquired in the first prepare())
+    SharedTables::Handle tanhTable;
+
+    float lookupTanh(float x) const noexcept { return tanhTable->lookupOdd(x); }
+
     // Saturation algorithms
     float softClip(float input);
     float diodeClipper(float input);
@@ -0,0 +1,126 @@
+#include "AnalysisView.h"
+
+namespace
+{
+    constexpr float meterFloorDb = -60.0f;
+    constexpr float spectrumFloorDb = -90.0f;
+    constexpr float spectrumMinHz = 20.0f;
+    constexpr int meterWidth = 150;
+
+    const char* const pathNames[] = { "Clean", "Octave", "Ring", "Comb", "Out" };
+
+    float dbToProportion(float db, float floorDb)
+    {
+        return juce::jlimit(0.0f, 1.0f, (db - floorDb) / -floorDb);
+    }
+}
+
+AnalysisView::AnalysisView(AnalysisTap& tap)
+    : analysisTap(tap)
+{
+    setOpaque(true);
+    spectrumPath.preallocateSpace(AnalysisTap::numSpectrumBins * 3);
+
+    analysisTap.addView();
+    startTimerHz(30);
+}
+
+AnalysisView::~AnalysisView()
+{
+    stopTimer();
+    analysisTap.removeView();
+}
+
+void AnalysisView::timerCallback()
+{
+    analysisTap.getSnapshot(snapshot);
+
+    // Only repaint when the analysis thread has published something new
+    if (snapshot.sequence != lastSequence)
+    {
+        lastSequence = snapshot.sequence;
+        repaint();
+    }
+}
+
+//==============================================================================
+void AnalysisView::paint(juce::Graphics& g)
+{
+    g.fillAll(juce::Colours::black);
+
+    auto area = getLocalBounds().reduced(6);
+    paintMeters(g, area.removeFromLeft(meterWidth));
+    area.removeFromLeft(6);
+    paintSpectrum(g, area);
+}
+
+void AnalysisView::paintMeters(juce::Graphics& g, juce::Rectangle<int> area)
+{
+    const int barWidth = area.getWidth() / AnalysisTap::numPaths;
+    auto labels = area.removeFromBottom(14);
+
+    for (int path = 0; path < AnalysisTap::numPaths; ++path)
+    {
+        auto bar = area.removeFromLeft(barWidth).reduced(3, 0);
+        auto label = labels.removeFromLeft(barWidth);
+
+        g.setColour(juce::Colours::darkgrey);
+        g.fillRect(bar);
+
+        // RMS as solid bar, peak as a hold line
+        const auto index = static_cast<size_t>(path);
+        const float rms = dbToProportion(snapshot.rmsDb[index], meterFloorDb);
+        const float peak = dbToProportion(snapshot.peakDb[index], meterFloorDb);
+
+        const int rmsHeight = juce::roundToInt(rms * static_cast<float>(bar.getHeight()));
+        g.setColour(snapshot.peakDb[index] > -1.0f ? juce::Colours::red : juce::Colours::green);
+        g.fillRect(bar.withTop(bar.getBottom() - rmsHeight));
+
+        const int peakY = bar.getBottom() - juce::roundToInt(peak * static_cast<float>(bar.getHeight()));
+        g.setColour(juce::Colours::white);
+        g.drawHorizontalLine(peakY, static_cast<float>(bar.getX()), static_cast<float>(bar.getRight()));
+
+        g.setColour(juce::Colours::lightgrey);
+        g.setFont(10.0f);
+        g.drawText(pathNames[path], label, juce::Justification::centred);
+    }
+}
+
+void AnalysisView::paintSpectrum(juce::Graphics& g, juce::Rectangle<int> area)
+{
+    g.setColour(juce::Colours::darkgrey);
+    g.drawRect(area);
+
+    const auto bounds = area.toFloat();
+    const float nyquist = static_cast<float>(snapshot.streamSampleRate * 0.5);
+    const float logRange = std::log(nyquist / spectrumMinHz);
+    const float binHz = static_cast<float>(snapshot.streamSampleRate) / static_cast<float>(AnalysisTap::fftSize);
+
+    // Log-frequency x axis, dB y axis
+    spectrumPath.clear();
+    bool started = false;
+
+    for (int bin = 1; bin < AnalysisTap::numSpectrumBins; ++bin)
+    {
+        const float hz = static_cast<float>(bin) * binHz;
+        if (hz < spectrumMinHz)
+            continue;
+
+        const float x = bounds.getX() + bounds.getWidth() * std::log(hz / spectrumMinHz) / logRange;
+        const float y = bounds.getBottom()
+                      - bounds.getHeight() * dbToProportion(snapshot.spectrumDb[static_cast<size_t>(bin)], spectrumFloorDb);
+
+        if (!started)
+        {
+            spectrumPath.startNewSubPath(x, y);
+            started = true;
+        }
+        else
+        {
+            spectrumPath.lineTo(x, y);
+        }
+    }
+
+    g.setColour(juce::Colours::orange);
+    g.strokePath(spectrumPath, juce::PathStrokeType(1.5f));
+}
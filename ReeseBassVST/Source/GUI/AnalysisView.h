@@ -0,0 +1,35 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "../Analysis/AnalysisTap.h"
+
+/**
+ * AnalysisView - Level Meters and Output Spectrum
+ *
+ * Draws per-path peak/RMS meters (clean, octave, ring, combined, output) and
+ * the output spectrum. Reads ready-made snapshots from the AnalysisTap on a
+ * 30 Hz timer; no analysis work happens on the message thread, and the audio
+ * thread is unaffected by how many views are open.
+ */
+class AnalysisView : public juce::Component,
+                     private juce::Timer
+{
+public:
+    explicit AnalysisView(AnalysisTap& tap);
+    ~AnalysisView() override;
+
+    void paint(juce::Graphics& g) override;
+
+private:
+    void timerCallback() override;
+
+    void paintMeters(juce::Graphics& g, juce::Rectangle<int> area);
+    void paintSpectrum(juce::Graphics& g, juce::Rectangle<int> area);
+
+    AnalysisTap& analysisTap;
+    AnalysisTap::Snapshot snapshot;
+    juce::uint32 lastSequence = 0;
+    juce::Path spectrumPath;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalysisView)
+};
@@ -0,0 +1,87 @@
+#include "FilterResponseView.h"
+
+namespace
+{
+    constexpr float topDb = 30.0f;
+    constexpr float bottomDb = -48.0f;
+}
+
+FilterResponseView::FilterResponseView(FilterResponse& response, juce::AudioProcessorValueTreeState& parameters)
+    : filterResponse(response)
+{
+    setOpaque(true);
+
+    filterModelValue = parameters.getRawParameterValue(ParameterTable::get(ParamID::filterModel).id);
+    cutoffValue = parameters.getRawParameterValue(ParameterTable::get(ParamID::cutoff).id);
+    resonanceValue = parameters.getRawParameterValue(ParameterTable::get(ParamID::resonance).id);
+
+    singlePath.preallocateSpace(FilterResponse::numPoints * 3);
+    cascadePath.preallocateSpace(FilterResponse::numPoints * 3);
+
+    filterResponse.addView();
+    startTimerHz(30);
+}
+
+FilterResponseView::~FilterResponseView()
+{
+    stopTimer();
+    filterResponse.removeView();
+}
+
+void FilterResponseView::timerCallback()
+{
+    FilterResponse::Curve latest;
+
+    // Same threshold as the processor's model switch
+    const auto model = filterModelValue->load() >= 0.5f ? FilterResponse::Model::LADDER
+                                                        : FilterResponse::Model::SVF;
+
+    // Cache lookup only; evaluation happens on the worker thread
+    if (filterResponse.getCurve(model, cutoffValue->load(), resonanceValue->load(), latest)
+        && (!hasCurve || latest.key != curve.key))
+    {
+        curve = latest;
+        hasCurve = true;
+        repaint();
+    }
+}
+
+void FilterResponseView::addCurveToPath(juce::Path& path, const std::array<float, FilterResponse::numPoints>& db) const
+{
+    const auto bounds = getLocalBounds().toFloat().reduced(2.0f);
+    path.clear();
+
+    for (int i = 0; i < FilterResponse::numPoints; ++i)
+    {
+        const float x = bounds.getX() + bounds.getWidth() * static_cast<float>(i) / static_cast<float>(FilterResponse::numPoints - 1);
+        const float clamped = juce::jlimit(bottomDb, topDb, db[static_cast<size_t>(i)]);
+        const float y = bounds.getY() + bounds.getHeight() * (topDb - clamped) / (topDb - bottomDb);
+
+        if (i == 0)
+            path.startNewSubPath(x, y);
+        else
+            path.lineTo(x, y);
+    }
+}
+
+void FilterResponseView::paint(juce::Graphics& g)
+{
+    g.fillAll(juce::Colours::black);
+
+    // 0 dB reference line
+    const auto bounds = getLocalBounds().toFloat().reduced(2.0f);
+    const float zeroY = bounds.getY() + bounds.getHeight() * topDb / (topDb - bottomDb);
+    g.setColour(juce::Colours::darkgrey);
+    g.drawHorizontalLine(juce::roundToInt(zeroY), bounds.getX(), bounds.getRight());
+
+    if (!hasCurve)
+        return;
+
+    addCurveToPath(cascadePath, curve.cascadeDb);
+    g.setColour(juce::Colours::cyan.withAlpha(0.5f));
+    g.strokePath(cascadePath, juce::PathStrokeType(1.0f));
+
+    addCurveToPath(singlePath, curve.singleDb);
+    g.setColour(juce::Colours::cyan);
+    g.strokePath(singlePath, juce::PathStrokeType(1.5f));
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "../Analysis/FilterResponse.h"
+#include "../Parameters/ParameterTable.h"
+
+/**
+ * FilterResponseView - Filter Magnitude Response Display
+ *
+ * Draws the low-pass response of one filter and of the filter1 -> filter3
+ * cascade for the current Filter Model, Cutoff and Resonance. Curves come from the
+ * FilterResponse cache; on a miss the previous curve stays on screen until
+ * the worker thread has computed the new one.
+ */
+class FilterResponseView : public juce::Component,
+                           private juce::Timer
+{
+public:
+    FilterResponseView(FilterResponse& response, juce::AudioProcessorValueTreeState& parameters);
+    ~FilterResponseView() override;
+
+    void paint(juce::Graphics& g) override;
+
+private:
+    void timerCallback() override;
+    void addCurveToPath(juce::Path& path, const std::array<float, FilterResponse::numPoints>& db) const;
+
+    FilterResponse& filterResponse;
+    std::atomic<float>* filterModelValue = nullptr;
+    std::atomic<float>* cutoffValue = nullptr;
+    std::atomic<float>* resonanceValue = nullptr;
+
+    FilterResponse::Curve curve;
+    bool hasCurve = false;
+    juce::Path singlePath, cascadePath;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FilterResponseView)
+};
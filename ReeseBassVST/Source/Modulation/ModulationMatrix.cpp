@@ -0,0 +1,139 @@
+#include "ModulationMatrix.h"
+
+namespace
+{
+    // Slot parameters are laid out as (source, destination, amount) triples
+    constexpr int slotStride = 3;
+
+    static_assert(toIndex(ParamID::mod2Source) == toIndex(ParamID::mod1Source) + slotStride
+               && toIndex(ParamID::mod4Amount) == toIndex(ParamID::mod1Source) + ModulationMatrix::numSlots * slotStride - 1,
+                  "Modulation slot parameters must be consecutive (source, destination, amount) triples");
+
+    static_assert(ParameterTable::get(ParamID::mod1Source).maxValue == static_cast<float>(ModulationMatrix::numSources - 1),
+                  "Mod source parameter range must cover every ModulationMatrix::Source");
+
+    ParamID slotParameter(ParamID first, int slot)
+    {
+        return static_cast<ParamID>(static_cast<int>(first) + slot * slotStride);
+    }
+
+    float sineLfo(float phase)
+    {
+        return std::sin(2.0f * juce::MathConstants<float>::pi * phase);
+    }
+}
+
+//==============================================================================
+namespace ParameterFormatters
+{
+    juce::String modulationSource(float value, int)
+    {
+        static const char* const names[] = { "None", "Ring LFO", "LFO 1", "LFO 2", "Input Env", "Sidechain Env" };
+        static_assert(std::size(names) == ModulationMatrix::numSources, "One name per source");
+
+        return names[juce::jlimit(0, ModulationMatrix::numSources - 1, juce::roundToInt(value))];
+    }
+
+    juce::String modulationDestination(float value, int)
+    {
+        const int index = juce::roundToInt(value) - 1;   // 0 = none
+
+        if (index < 0 || index >= numModulationDestinations)
+            return "None";
+
+        return ParameterTable::get(modulationDestinations[static_cast<size_t>(index)]).name;
+    }
+}
+
+//==============================================================================
+ModulationMatrix::ModulationMatrix()
+{
+}
+
+void ModulationMatrix::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+    reset();
+}
+
+void ModulationMatrix::reset()
+{
+    lfo1Phase = 0.0f;
+    lfo2Phase = 0.25f;
+}
+
+bool ModulationMatrix::updateRoutings(const std::array<std::atomic<float>*, numParameters>& values)
+{
+    const auto previous = modulatedParameters;
+
+    numRoutings = 0;
+    sourcesInUse = 0;
+    modulatedParameters.fill(false);
+    output.numDestinations = 0;
+
+    for (int slot = 0; slot < numSlots; ++slot)
+    {
+        const auto read = [&](ParamID first) { return values[toIndex(slotParameter(first, slot))]->load(); };
+
+        const int source = juce::roundToInt(read(ParamID::mod1Source));
+        const int destination = juce::roundToInt(read(ParamID::mod1Destination)) - 1;   // 0 = none
+        const float amount = read(ParamID::mod1Amount);
+
+        if (source <= 0 || source >= numSources
+         || destination < 0 || destination >= numModulationDestinations
+         || amount == 0.0f)
+            continue;
+
+        const auto destinationID = modulationDestinations[static_cast<size_t>(destination)];
+
+        // Several routings to the same destination share one output entry
+        int destinationSlot = 0;
+        while (destinationSlot < output.numDestinations && output.destinations[static_cast<size_t>(destinationSlot)] != destinationID)
+            ++destinationSlot;
+
+        if (destinationSlot == output.numDestinations)
+            output.destinations[static_cast<size_t>(output.numDestinations++)] = destinationID;
+
+        routings[static_cast<size_t>(numRoutings++)] = { static_cast<Source>(source), destinationSlot, amount };
+        sourcesInUse |= 1u << static_cast<unsigned>(source);
+        modulatedParameters[toIndex(destinationID)] = true;
+    }
+
+    return modulatedParameters != previous;
+}
+
+//==============================================================================
+void ModulationMatrix::advanceLfos(int numSamples, float lfo1Rate, float lfo2Rate)
+{
+    const float blockSeconds = static_cast<float>(numSamples / sampleRate);
+
+    lfo1Phase += lfo1Rate * blockSeconds;
+    lfo1Phase -= std::floor(lfo1Phase);
+
+    lfo2Phase += lfo2Rate * blockSeconds;
+    lfo2Phase -= std::floor(lfo2Phase);
+}
+
+float ModulationMatrix::getLfo1() const
+{
+    return sineLfo(lfo1Phase);
+}
+
+float ModulationMatrix::getLfo2() const
+{
+    return sineLfo(lfo2Phase);
+}
+
+const ModulationMatrix::Output& ModulationMatrix::evaluate(const SourceValues& sources)
+{
+    std::fill(output.offsets.begin(), output.offsets.begin() + output.numDestinations, 0.0f);
+
+    for (int i = 0; i < numRoutings; ++i)
+    {
+        const auto& routing = routings[static_cast<size_t>(i)];
+        output.offsets[static_cast<size_t>(routing.destinationSlot)]
+            += routing.amount * sources[static_cast<size_t>(routing.source)];
+    }
+
+    return output;
+}
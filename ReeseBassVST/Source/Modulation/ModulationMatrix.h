@@ -0,0 +1,136 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include "../Parameters/ParameterTable.h"
+
+/**
+ * ModulationMatrix - Sparse Control-Rate Modulation Routing
+ *
+ * A fixed number of slots, each routing one source to one destination
+ * parameter with a bipolar amount:
+ *
+ *   Sources:      Ring LFO, LFO 1, LFO 2, input envelope, sidechain envelope
+ *   Destinations: the continuous sound parameters (modulationDestinations
+ *                 in ParameterTable.h; toggles are not offered)
+ *
+ * The matrix never touches audio. Once per processBlock the processor hands
+ * it the slot parameters and it compacts them into a list of active routings
+ * (source set, destination set, amount != 0). Once per control block it sums
+ * the active routings per destination in the normalized 0-1 domain, so a
+ * routing to a logarithmic parameter moves it in octaves, and returns only
+ * the destinations that are modulated. The processor writes those values
+ * into the matching parameter smoothers as targets, which makes modulation
+ * follow the same path as automation. Unmodulated parameters cost nothing,
+ * and no extra per-sample work is added for modulated ones.
+ *
+ * The two free-running LFOs (sine) also advance at control rate.
+ */
+class ModulationMatrix
+{
+public:
+    static constexpr int numSlots = 4;
+
+    enum class Source
+    {
+        NONE,
+        RING_LFO,            // The ring modulator's LFO (bipolar)
+        LFO1,                // Free-running sine (bipolar)
+        LFO2,                // Free-running sine (bipolar)
+        INPUT_ENVELOPE,      // Main input level (unipolar 0-1)
+        SIDECHAIN_ENVELOPE,  // Sidechain level (unipolar 0-1)
+        NUM_SOURCES
+    };
+
+    static constexpr int numSources = static_cast<int>(Source::NUM_SOURCES);
+
+    /**
+     * Current value of every source for one control block
+     */
+    using SourceValues = std::array<float, numSources>;
+
+    /**
+     * Modulated destinations of one control block (normalized offsets)
+     */
+    struct Output
+    {
+        std::array<ParamID, numSlots> destinations {};
+        std::array<float, numSlots> offsets {};
+        int numDestinations = 0;
+    };
+
+    ModulationMatrix();
+
+    /**
+     * Prepare the module for processing
+     * @param sampleRate The sample rate in Hz
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * Rebuild the active routing list from the slot parameters (once per block)
+     * @param values Current parameter values
+     * @return True if the set of modulated destinations changed
+     */
+    bool updateRoutings(const std::array<std::atomic<float>*, numParameters>& values);
+
+    /**
+     * True if any active routing reads the given source
+     */
+    bool usesSource(Source source) const { return (sourcesInUse & (1u << static_cast<unsigned>(source))) != 0; }
+
+    /**
+     * True if the given parameter is an active destination
+     */
+    bool isModulated(ParamID id) const { return modulatedParameters[toIndex(id)]; }
+
+    /**
+     * Advance the free-running LFOs by one control block
+     * @param numSamples Control block length in samples
+     * @param lfo1Rate LFO 1 rate in Hz
+     * @param lfo2Rate LFO 2 rate in Hz
+     */
+    void advanceLfos(int numSamples, float lfo1Rate, float lfo2Rate);
+
+    /**
+     * Free-running LFO values (for filling SourceValues)
+     */
+    float getLfo1() const;
+    float getLfo2() const;
+
+    /**
+     * Sum the active routings per destination
+     * @param sources Current source values
+     * @return Normalized offsets for the modulated destinations only
+     */
+    const Output& evaluate(const SourceValues& sources);
+
+    /**
+     * Reset internal state
+     */
+    void reset();
+
+private:
+    struct Routing
+    {
+        Source source;
+        int destinationSlot;   // Index into output.destinations
+        float amount;
+    };
+
+    // Sample rate
+    double sampleRate = 44100.0;
+
+    // Active routings (compacted, only these are evaluated)
+    std::array<Routing, numSlots> routings {};
+    int numRoutings = 0;
+    unsigned sourcesInUse = 0;
+    std::array<bool, numParameters> modulatedParameters {};
+
+    // LFO phases (0.0-1.0)
+    float lfo1Phase = 0.0f;
+    float lfo2Phase = 0.25f;   // Quadrature start so the two LFOs differ at rest
+
+    Output output;
+};
@@ -0,0 +1,175 @@
+#include "ParameterHistory.h"
+#include <utility>
+
+ParameterHistory::ParameterHistory(juce::AudioProcessorValueTreeState& state)
+{
+    for (const auto& descriptor : parameterTable)
+    {
+        const auto index = toIndex(descriptor.paramID);
+        auto* parameter = state.getParameter(descriptor.id);
+
+        // Gestures report the processor's parameter index, which follows the table
+        jassert(parameter != nullptr && parameter->getParameterIndex() == static_cast<int>(index));
+
+        parameters[index] = parameter;
+        parameter->addListener(this);
+    }
+}
+
+ParameterHistory::~ParameterHistory()
+{
+    for (auto* parameter : parameters)
+        parameter->removeListener(this);
+}
+
+//==============================================================================
+void ParameterHistory::recordChanges(const ParameterValues& values)
+{
+    jassert(juce::MessageManager::existsAndIsCurrentThread());
+
+    const auto now = juce::Time::getMillisecondCounter();
+    bool recorded = false;
+
+    for (const auto& descriptor : parameterTable)
+    {
+        const auto index = toIndex(descriptor.paramID);
+        auto* parameter = parameters[index];
+
+        const float oldValue = parameter->getValue();
+        const float newValue = parameter->convertTo0to1(values[descriptor.paramID]);
+
+        if (newValue == oldValue)
+            continue;
+
+        if (!std::exchange(recorded, true))
+            beginStep();
+
+        push(static_cast<int>(index), oldValue, newValue, now);
+    }
+
+    if (recorded)
+        sendChangeMessage();
+}
+
+void ParameterHistory::parameterGestureChanged(int parameterIndex, bool gestureIsStarting)
+{
+    // Our own undo/redo, or a gesture from another thread (hosts touching automation)
+    if (applying || !juce::isPositiveAndBelow(parameterIndex, numParameters)
+        || !juce::MessageManager::existsAndIsCurrentThread())
+        return;
+
+    const auto index = static_cast<size_t>(parameterIndex);
+    const auto now = juce::Time::getMillisecondCounter();
+
+    if (gestureIsStarting)
+    {
+        gestureStart[index] = parameters[index]->getValue();
+        gestureTime[index] = now;
+        gestureOpen[index] = true;
+        return;
+    }
+
+    if (!std::exchange(gestureOpen[index], false))
+        return;
+
+    const float newValue = parameters[index]->getValue();
+
+    if (newValue == gestureStart[index])
+        return;
+
+    // Extends the last step: the same parameter alone, shortly after, nothing undone since
+    if (canUndo() && !canRedo())
+    {
+        auto& last = at(cursor - 1);
+        const bool alone = cursor - 1 == oldest || at(cursor - 2).transaction != last.transaction;
+
+        if (alone && last.parameterIndex == parameterIndex && gestureTime[index] - last.timestamp < coalesceTime)
+        {
+            last.newValue = newValue;
+            last.timestamp = now;
+
+            // Back where it started: nothing to undo
+            if (last.newValue == last.oldValue)
+                newest = --cursor;
+
+            sendChangeMessage();
+            return;
+        }
+    }
+
+    beginStep();
+    push(parameterIndex, gestureStart[index], newValue, now);
+    sendChangeMessage();
+}
+
+//==============================================================================
+void ParameterHistory::beginStep()
+{
+    newest = cursor;
+    ++transaction;
+}
+
+void ParameterHistory::push(int parameterIndex, float oldValue, float newValue, std::uint32_t timestamp)
+{
+    // Full: the oldest whole step goes (never the one being written, see capacity)
+    if (newest - oldest == capacity)
+    {
+        const auto dropped = at(oldest).transaction;
+
+        while (oldest != newest && at(oldest).transaction == dropped)
+            ++oldest;
+    }
+
+    at(newest) = { static_cast<std::uint16_t>(parameterIndex), transaction, oldValue, newValue, timestamp };
+    cursor = ++newest;
+}
+
+bool ParameterHistory::undo()
+{
+    if (!canUndo())
+        return false;
+
+    const auto step = at(cursor - 1).transaction;
+
+    while (cursor != oldest && at(cursor - 1).transaction == step)
+    {
+        --cursor;
+        setValue(at(cursor).parameterIndex, at(cursor).oldValue);
+    }
+
+    sendChangeMessage();
+    return true;
+}
+
+bool ParameterHistory::redo()
+{
+    if (!canRedo())
+        return false;
+
+    const auto step = at(cursor).transaction;
+
+    while (cursor != newest && at(cursor).transaction == step)
+    {
+        setValue(at(cursor).parameterIndex, at(cursor).newValue);
+        ++cursor;
+    }
+
+    sendChangeMessage();
+    return true;
+}
+
+void ParameterHistory::clear()
+{
+    oldest = cursor = newest;
+    sendChangeMessage();
+}
+
+void ParameterHistory::setValue(int parameterIndex, float value)
+{
+    const juce::ScopedValueSetter<bool> ignoreOwnGestures(applying, true);
+    auto* parameter = parameters[static_cast<size_t>(parameterIndex)];
+
+    parameter->beginChangeGesture();
+    parameter->setValueNotifyingHost(value);
+    parameter->endChangeGesture();
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_events/juce_events.h>
+#include <array>
+#include <cstdint>
+#include "ParameterTable.h"
+
+/**
+ * ParameterHistory - Undo/Redo of Parameter Edits as Compact Deltas
+ *
+ * Every edit is stored as a 16-byte delta (parameter index, old and new
+ * normalized value, time) in a fixed ring buffer, so an instance's history
+ * costs the same few kilobytes however long the session runs. Deltas with
+ * the same transaction number are one undo step (a preset sets many
+ * parameters at once); when the buffer is full the oldest whole step goes.
+ *
+ * Only user edits are recorded: a change gesture (a slider drag, a button
+ * click) becomes one delta from its start value to its end value, so a drag
+ * is a single step no matter how many values it passed through. Gestures on
+ * the same parameter within coalesceTime of the last one (mouse wheel
+ * ticks, small nudges) extend that step. Host automation has no gestures
+ * and is never recorded.
+ *
+ * Not an UndoManager in the APVTS slot: JUCE's UndoManager keeps a heap
+ * allocated action per value tree change, automation included, and cannot
+ * be redirected. Message thread only; broadcasts when undo/redo availability
+ * may have changed.
+ */
+class ParameterHistory : private juce::AudioProcessorParameter::Listener,
+                         public juce::ChangeBroadcaster
+{
+public:
+    static constexpr int capacity = 512;                     // Deltas (8 KiB)
+    static constexpr std::uint32_t coalesceTime = 500;       // ms
+
+    struct Delta
+    {
+        std::uint16_t parameterIndex;
+        std::uint16_t transaction;     // Equal on neighbouring deltas of one undo step
+        float oldValue;                // Normalized 0-1
+        float newValue;
+        std::uint32_t timestamp;       // juce::Time::getMillisecondCounter()
+    };
+
+    static_assert(sizeof(Delta) == 16, "Delta should stay compact");
+    static_assert(capacity >= 2 * numParameters, "A preset must fit in the history");
+    static_assert((capacity & (capacity - 1)) == 0, "Ring positions wrap at 2^32");
+
+    explicit ParameterHistory(juce::AudioProcessorValueTreeState& state);
+    ~ParameterHistory() override;
+
+    /**
+     * Record setting every parameter to values (real units) as one undo step.
+     * Call just before setting them (presets)
+     */
+    void recordChanges(const ParameterValues& values);
+
+    bool canUndo() const noexcept { return cursor != oldest; }
+    bool canRedo() const noexcept { return cursor != newest; }
+
+    /**
+     * Step back or forward; the parameters are set as gestures so hosts see user edits
+     */
+    bool undo();
+    bool redo();
+
+    /**
+     * Forget everything (a restored state starts a new history)
+     */
+    void clear();
+
+private:
+    //==============================================================================
+    void parameterValueChanged(int, float) override {}
+    void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override;
+
+    Delta& at(std::uint32_t position) noexcept { return deltas[position % capacity]; }
+
+    // A new undo step (drops the redo steps), then its deltas
+    void beginStep();
+    void push(int parameterIndex, float oldValue, float newValue, std::uint32_t timestamp);
+    void setValue(int parameterIndex, float value);
+
+    //==============================================================================
+    std::array<juce::RangedAudioParameter*, numParameters> parameters {};
+
+    // Ring positions (wrapping counters): [oldest, cursor) undo, [cursor, newest) redo
+    std::array<Delta, capacity> deltas {};
+    std::uint32_t oldest = 0;
+    std::uint32_t cursor = 0;
+    std::uint32_t newest = 0;
+    std::uint16_t transaction = 0;
+
+    // Open gestures: the value and time each started from
+    std::array<float, numParameters> gestureStart {};
+    std::array<std::uint32_t, numParameters> gestureTime {};
+    std::array<bool, numParameters> gestureOpen {};
+    bool applying = false;   // Our own undo/redo gestures are not recorded
+
+    JUCE_DECLARE_NON_COPYABLE(ParameterHistory)
+};
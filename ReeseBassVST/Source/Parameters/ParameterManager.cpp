@@ -32,12 +32,18 @@ const ParameterManager::Preset& ParameterManager::getFactoryPreset(int index) co
 
 void ParameterManager::applyPreset(const Preset& preset, juce::AudioProcessorValueTreeState& parameters)
 {
-    for (const auto& param : preset.parameters)
+    for (const auto& descriptor : parameterTable)
     {
-        auto* parameter = parameters.getParameter(param.first);
+        // Engine options (bypass, multi-core, ...) belong to the instance, not the sound
+        if (!ParameterTable::isPresetParameter(descriptor))
+            continue;
+
+        auto* parameter = parameters.getParameter(descriptor.id);
         if (parameter != nullptr)
         {
-            parameter->setValueNotifyingHost(param.second);
+            // Preset values are stored in real units; the host expects normalized 0-1
+            float value = preset.parameters[descriptor.paramID];
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
         }
     }
 }
@@ -52,16 +58,16 @@ ParameterManager::Preset ParameterManager::createPresetFromCurrentState(
     preset.description = description;
     preset.genre = "User";
 
-    // Get all parameter IDs and values
-    const juce::StringArray paramIDs = {"cutoff", "resonance", "ringRate", "ringDepth",
-                                        "octaveBlend", "character", "drive", "volume"};
-
-    for (const auto& paramID : paramIDs)
+    // Capture every preset parameter (the rest keep their table defaults)
+    for (const auto& descriptor : parameterTable)
     {
-        auto* param = parameters.getRawParameterValue(paramID);
+        if (!ParameterTable::isPresetParameter(descriptor))
+            continue;
+
+        auto* param = parameters.getRawParameterValue(descriptor.id);
         if (param != nullptr)
         {
-            preset.parameters[paramID] = param->load();
+            preset.parameters[descriptor.paramID] = param->load();
         }
     }
 
@@ -78,9 +84,10 @@ bool ParameterManager::savePresetToFile(const Preset& preset, const juce::File&
 
     auto* paramsElement = root.createNewChildElement("Parameters");
 
-    for (const auto& param : preset.parameters)
+    for (const auto& descriptor : parameterTable)
     {
-        paramsElement->setAttribute(param.first, param.second);
+        if (ParameterTable::isPresetParameter(descriptor))
+            paramsElement->setAttribute(descriptor.id, preset.parameters[descriptor.paramID]);
     }
 
     return root.writeTo(filepath);
@@ -103,12 +110,15 @@ bool ParameterManager::loadPresetFromFile(const juce::File& filepath, Preset& pr
     auto* paramsElement = xml->getChildByName("Parameters");
     if (paramsElement != nullptr)
     {
-        const juce::StringArray paramIDs = {"cutoff", "resonance", "ringRate", "ringDepth",
-                                            "octaveBlend", "character", "drive", "volume"};
-
-        for (const auto& paramID : paramIDs)
+        // Missing attributes (older preset files) fall back to the table default;
+        // engine rows that older files stored are ignored
+        for (const auto& descriptor : parameterTable)
         {
-            preset.parameters[paramID] = static_cast<float>(paramsElement->getDoubleAttribute(paramID));
+            if (!ParameterTable::isPresetParameter(descriptor))
+                continue;
+
+            preset.parameters[descriptor.paramID] = static_cast<float>(
+                paramsElement->getDoubleAttribute(descriptor.id, descriptor.defaultValue));
         }
     }
 
@@ -126,14 +136,14 @@ void ParameterManager::createClassicDnBPreset()
     preset.description = "The quintessential drum & bass Reese sound. Medium tension, organic movement, perfect for rolling basslines.";
     preset.genre = "DnB";
 
-    preset.parameters["cutoff"] = 600.0f;
-    preset.parameters["resonance"] = 0.70f;
-    preset.parameters["ringRate"] = 3.5f;
-    preset.parameters["ringDepth"] = 0.50f;
-    preset.parameters["octaveBlend"] = 0.40f;
-    preset.parameters["character"] = 0.60f;
-    preset.parameters["drive"] = 1.20f;
-    preset.parameters["volume"] = 0.0f;
+    preset.parameters[ParamID::cutoff] = 600.0f;
+    preset.parameters[ParamID::resonance] = 0.70f;
+    preset.parameters[ParamID::ringRate] = 3.5f;
+    preset.parameters[ParamID::ringDepth] = 0.50f;
+    preset.parameters[ParamID::octaveBlend] = 0.40f;
+    preset.parameters[ParamID::character] = 0.60f;
+    preset.parameters[ParamID::drive] = 1.20f;
+    preset.parameters[ParamID::volume] = 0.0f;
 
     factoryPresets.push_back(preset);
 }
@@ -145,14 +155,14 @@ void ParameterManager::createSubTerrorPreset()
     preset.description = "Deep, ominous sub-bass emphasis. Slow modulation creates breathing effect. Ideal for half-time and liquid DnB.";
     preset.genre = "DnB/Halftime";
 
-    preset.parameters["cutoff"] = 300.0f;
-    preset.parameters["resonance"] = 0.80f;
-    preset.parameters["ringRate"] = 1.5f;
-    preset.parameters["ringDepth"] = 0.30f;
-    preset.parameters["octaveBlend"] = 0.70f;
-    preset.parameters["character"] = 0.40f;
-    preset.parameters["drive"] = 1.00f;
-    preset.parameters["volume"] = 0.0f;
+    preset.parameters[ParamID::cutoff] = 300.0f;
+    preset.parameters[ParamID::resonance] = 0.80f;
+    preset.parameters[ParamID::ringRate] = 1.5f;
+    preset.parameters[ParamID::ringDepth] = 0.30f;
+    preset.parameters[ParamID::octaveBlend] = 0.70f;
+    preset.parameters[ParamID::character] = 0.40f;
+    preset.parameters[ParamID::drive] = 1.00f;
+    preset.parameters[ParamID::volume] = 0.0f;
 
     factoryPresets.push_back(preset);
 }
@@ -164,14 +174,14 @@ void ParameterManager::createIndustrialGrindPreset()
     preset.description = "Aggressive, harsh, grinding Reese. Fast modulation and heavy saturation. Perfect for dark techno and industrial.";
     preset.genre = "Industrial/Techno";
 
-    preset.parameters["cutoff"] = 800.0f;
-    preset.parameters["resonance"] = 0.85f;
-    preset.parameters["ringRate"] = 7.0f;
-    preset.parameters["ringDepth"] = 0.75f;
-    preset.parameters["octaveBlend"] = 0.35f;
-    preset.parameters["character"] = 0.80f;
-    preset.parameters["drive"] = 1.80f;
-    preset.parameters["volume"] = 0.0f;
+    preset.parameters[ParamID::cutoff] = 800.0f;
+    preset.parameters[ParamID::resonance] = 0.85f;
+    preset.parameters[ParamID::ringRate] = 7.0f;
+    preset.parameters[ParamID::ringDepth] = 0.75f;
+    preset.parameters[ParamID::octaveBlend] = 0.35f;
+    preset.parameters[ParamID::character] = 0.80f;
+    preset.parameters[ParamID::drive] = 1.80f;
+    preset.parameters[ParamID::volume] = 0.0f;
 
     factoryPresets.push_back(preset);
 }
@@ -183,14 +193,14 @@ void ParameterManager::createDubstepWobblePreset()
     preset.description = "High cutoff with extreme resonance creates wobble-like movement. Brutal and in-your-face.";
     preset.genre = "Dubstep";
 
-    preset.parameters["cutoff"] = 1200.0f;
-    preset.parameters["resonance"] = 0.90f;
-    preset.parameters["ringRate"] = 4.0f;
-    preset.parameters["ringDepth"] = 0.85f;
-    preset.parameters["octaveBlend"] = 0.20f;
-    preset.parameters["character"] = 0.70f;
-    preset.parameters["drive"] = 1.50f;
-    preset.parameters["volume"] = 0.0f;
+    preset.parameters[ParamID::cutoff] = 1200.0f;
+    preset.parameters[ParamID::resonance] = 0.90f;
+    preset.parameters[ParamID::ringRate] = 4.0f;
+    preset.parameters[ParamID::ringDepth] = 0.85f;
+    preset.parameters[ParamID::octaveBlend] = 0.20f;
+    preset.parameters[ParamID::character] = 0.70f;
+    preset.parameters[ParamID::drive] = 1.50f;
+    preset.parameters[ParamID::volume] = 0.0f;
 
     factoryPresets.push_back(preset);
 }
@@ -202,14 +212,14 @@ void ParameterManager::createSmoothOperatorPreset()
     preset.description = "Subtle Reese effect, adds slight detuning and warmth without overwhelming the clean bass. Great for funk and house.";
     preset.genre = "House/Funk";
 
-    preset.parameters["cutoff"] = 700.0f;
-    preset.parameters["resonance"] = 0.40f;
-    preset.parameters["ringRate"] = 2.0f;
-    preset.parameters["ringDepth"] = 0.25f;
-    preset.parameters["octaveBlend"] = 0.30f;
-    preset.parameters["character"] = 0.35f;
-    preset.parameters["drive"] = 0.80f;
-    preset.parameters["volume"] = 0.0f;
+    preset.parameters[ParamID::cutoff] = 700.0f;
+    preset.parameters[ParamID::resonance] = 0.40f;
+    preset.parameters[ParamID::ringRate] = 2.0f;
+    preset.parameters[ParamID::ringDepth] = 0.25f;
+    preset.parameters[ParamID::octaveBlend] = 0.30f;
+    preset.parameters[ParamID::character] = 0.35f;
+    preset.parameters[ParamID::drive] = 0.80f;
+    preset.parameters[ParamID::volume] = 0.0f;
 
     factoryPresets.push_back(preset);
 }
@@ -221,14 +231,14 @@ void ParameterManager::createNeurofunkMadnessPreset()
     preset.description = "Chaotic, complex Reese with fast modulation. Creates unpredictable harmonic content. Pure neurofunk energy.";
     preset.genre = "Neurofunk";
 
-    preset.parameters["cutoff"] = 500.0f;
-    preset.parameters["resonance"] = 0.75f;
-    preset.parameters["ringRate"] = 8.5f;
-    preset.parameters["ringDepth"] = 0.90f;
-    preset.parameters["octaveBlend"] = 0.50f;
-    preset.parameters["character"] = 0.90f;
-    preset.parameters["drive"] = 1.60f;
-    preset.parameters["volume"] = -2.0f;
+    preset.parameters[ParamID::cutoff] = 500.0f;
+    preset.parameters[ParamID::resonance] = 0.75f;
+    preset.parameters[ParamID::ringRate] = 8.5f;
+    preset.parameters[ParamID::ringDepth] = 0.90f;
+    preset.parameters[ParamID::octaveBlend] = 0.50f;
+    preset.parameters[ParamID::character] = 0.90f;
+    preset.parameters[ParamID::drive] = 1.60f;
+    preset.parameters[ParamID::volume] = -2.0f;
 
     factoryPresets.push_back(preset);
 }
@@ -240,14 +250,14 @@ void ParameterManager::createMinimalDeepPreset()
     preset.description = "Very subtle effect, mostly sub-octave reinforcement. Adds weight without obvious modulation. Minimal techno friendly.";
     preset.genre = "Minimal/Techno";
 
-    preset.parameters["cutoff"] = 400.0f;
-    preset.parameters["resonance"] = 0.30f;
-    preset.parameters["ringRate"] = 1.0f;
-    preset.parameters["ringDepth"] = 0.20f;
-    preset.parameters["octaveBlend"] = 0.60f;
-    preset.parameters["character"] = 0.30f;
-    preset.parameters["drive"] = 0.90f;
-    preset.parameters["volume"] = 0.0f;
+    preset.parameters[ParamID::cutoff] = 400.0f;
+    preset.parameters[ParamID::resonance] = 0.30f;
+    preset.parameters[ParamID::ringRate] = 1.0f;
+    preset.parameters[ParamID::ringDepth] = 0.20f;
+    preset.parameters[ParamID::octaveBlend] = 0.60f;
+    preset.parameters[ParamID::character] = 0.30f;
+    preset.parameters[ParamID::drive] = 0.90f;
+    preset.parameters[ParamID::volume] = 0.0f;
 
     factoryPresets.push_back(preset);
 }
@@ -259,14 +269,14 @@ void ParameterManager::createDistortedBeastPreset()
     preset.description = "Maximum saturation creates gritty, distorted character. Aggressive and punchy. Crossbreed/darkstep specialist.";
     preset.genre = "Crossbreed/Darkstep";
 
-    preset.parameters["cutoff"] = 900.0f;
-    preset.parameters["resonance"] = 0.65f;
-    preset.parameters["ringRate"] = 5.0f;
-    preset.parameters["ringDepth"] = 0.60f;
-    preset.parameters["octaveBlend"] = 0.45f;
-    preset.parameters["character"] = 0.75f;
-    preset.parameters["drive"] = 2.00f;
-    preset.parameters["volume"] = -3.0f;
+    preset.parameters[ParamID::cutoff] = 900.0f;
+    preset.parameters[ParamID::resonance] = 0.65f;
+    preset.parameters[ParamID::ringRate] = 5.0f;
+    preset.parameters[ParamID::ringDepth] = 0.60f;
+    preset.parameters[ParamID::octaveBlend] = 0.45f;
+    preset.parameters[ParamID::character] = 0.75f;
+    preset.parameters[ParamID::drive] = 2.00f;
+    preset.parameters[ParamID::volume] = -3.0f;
 
     factoryPresets.push_back(preset);
 }
@@ -3,13 +3,16 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_data_structures/juce_data_structures.h>
 #include <vector>
-#include <map>
+#include "ParameterTable.h"
 
 /**
  * ParameterManager - Preset Management System
  *
  * Manages factory presets and user presets for the Reese Destroyer plugin.
  * Handles loading, saving, and importing/exporting preset files.
+ *
+ * The file functions block on disk I/O; the plugin reads and writes preset
+ * files through PresetService, which runs them on a background thread.
  */
 class ParameterManager
 {
@@ -22,7 +25,7 @@ public:
         juce::String name;
         juce::String description;
         juce::String genre;
-        std::map<juce::String, float> parameters;
+        ParameterValues parameters;   // Fixed-size, indexed by ParamID (defaults pre-filled)
     };
 
     ParameterManager();
@@ -58,7 +61,7 @@ public:
      * @param description Preset description
      * @return New preset
      */
-    Preset createPresetFromCurrentState(
+    static Preset createPresetFromCurrentState(
         const juce::AudioProcessorValueTreeState& parameters,
         const juce::String& name,
         const juce::String& description);
@@ -69,7 +72,7 @@ public:
      * @param filepath Output file path
      * @return True if successful
      */
-    bool savePresetToFile(const Preset& preset, const juce::File& filepath);
+    static bool savePresetToFile(const Preset& preset, const juce::File& filepath);
 
     /**
      * Load a preset from XML file
@@ -77,7 +80,7 @@ public:
      * @param preset Output preset structure
      * @return True if successful
      */
-    bool loadPresetFromFile(const juce::File& filepath, Preset& preset);
+    static bool loadPresetFromFile(const juce::File& filepath, Preset& preset);
 
 private:
     std::vector<Preset> factoryPresets;
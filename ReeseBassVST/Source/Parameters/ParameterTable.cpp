@@ -0,0 +1,75 @@
+#include "ParameterTable.h"
+
+namespace ParameterTable
+{
+
+juce::NormalisableRange<float> makeRange(const ParameterDescriptor& descriptor)
+{
+    if (descriptor.scale == ParameterScale::TOGGLE)
+        return juce::NormalisableRange<float>(0.0f, 1.0f, 1.0f);
+
+    if (descriptor.scale == ParameterScale::LOGARITHMIC)
+    {
+        // Logarithmic mapping gives perceptually linear control over frequency
+        return juce::NormalisableRange<float>(descriptor.minValue, descriptor.maxValue,
+            [](float start, float end, float normalized) {
+                return start * std::pow(end / start, normalized);
+            },
+            [](float start, float end, float value) {
+                return std::log(value / start) / std::log(end / start);
+            });
+    }
+
+    return juce::NormalisableRange<float>(descriptor.minValue, descriptor.maxValue, descriptor.interval);
+}
+
+float constrainValue(const ParameterDescriptor& descriptor, float value)
+{
+    const auto range = makeRange(descriptor);
+    const float legal = range.snapToLegalValue(value);
+
+    if (descriptor.scale == ParameterScale::TOGGLE)
+        return legal >= 0.5f ? 1.0f : 0.0f;
+
+    // Through the normalized value, as AudioParameterFloat stores it
+    return range.convertFrom0to1(range.convertTo0to1(legal));
+}
+
+juce::AudioProcessorValueTreeState::ParameterLayout createLayout()
+{
+    juce::AudioProcessorValueTreeState::ParameterLayout layout;
+
+    for (const auto& descriptor : parameterTable)
+    {
+        if (descriptor.scale == ParameterScale::TOGGLE)
+        {
+            const auto formatter = descriptor.formatter;
+
+            layout.add(std::make_unique<juce::AudioParameterBool>(
+                descriptor.id,
+                descriptor.name,
+                descriptor.defaultValue >= 0.5f,
+                juce::String(),
+                [formatter](bool value, int maximumStringLength) {
+                    return formatter(value ? 1.0f : 0.0f, maximumStringLength);
+                }
+            ));
+
+            continue;
+        }
+
+        layout.add(std::make_unique<juce::AudioParameterFloat>(
+            descriptor.id,
+            descriptor.name,
+            makeRange(descriptor),
+            descriptor.defaultValue,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            descriptor.formatter
+        ));
+    }
+
+    return layout;
+}
+
+} // namespace ParameterTable
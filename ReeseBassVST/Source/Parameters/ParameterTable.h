@@ -0,0 +1,298 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include <cstddef>
+
+/**
+ * ParameterTable - Compile-Time Parameter Descriptors
+ *
+ * Single source of truth for every automatable parameter of the plugin.
+ * The APVTS layout, the processor's atomic pointer array and preset storage
+ * are all generated from this table and indexed by ParamID, so adding a
+ * parameter means adding one enum entry and one table row.
+ *
+ * Rows must appear in the same order as the ParamID enum (checked by a
+ * static_assert below).
+ */
+
+//==============================================================================
+enum class ParamID : int
+{
+    cutoff,
+    resonance,
+    ringRate,
+    ringDepth,
+    octaveBlend,
+    character,
+    drive,
+    volume,
+    stereoWidth,
+    noiseAmount,
+    multiband,
+    crossoverLow,
+    crossoverHigh,
+    subCharacter,
+    highCharacter,
+    sidechainAttack,
+    sidechainRelease,
+    sidechainRms,
+    duckCutoff,
+    duckRingDepth,
+    duckDrive,
+
+    // Modulation matrix (the continuous parameters above are modulation destinations)
+    lfo1Rate,
+    lfo2Rate,
+    mod1Source,
+    mod1Destination,
+    mod1Amount,
+    mod2Source,
+    mod2Destination,
+    mod2Amount,
+    mod3Source,
+    mod3Destination,
+    mod3Amount,
+    mod4Source,
+    mod4Destination,
+    mod4Amount,
+
+    // Output stage (changes latency, so not a modulation destination)
+    limiterMode,
+    limiterLookahead,
+    limiterCeiling,
+
+    // Engine (processing options, not sound parameters)
+    multiCore,
+    offlineQuality,
+    stereoLink,
+    bypass,
+
+    // Filter model of the three chain paths (appended: state blocks store parameters
+    // by index; discrete, so not a modulation destination)
+    filterModel,
+
+    // Cabinet IR stage (appended; the IR file itself is stored in a state chunk)
+    cabinet,
+    cabinetMix,
+
+    count
+};
+
+constexpr int numParameters = static_cast<int>(ParamID::count);
+
+constexpr std::size_t toIndex(ParamID id) noexcept
+{
+    return static_cast<std::size_t>(id);
+}
+
+// Parameters that modulation routings may target: the continuous sound parameters.
+// A routing's destination value is an index into this list + 1 (0 = none). Toggles
+// are left out: they are switches, not something a modulation offset can sweep.
+inline constexpr std::array modulationDestinations {
+    ParamID::cutoff,           ParamID::resonance,        ParamID::ringRate,         ParamID::ringDepth,
+    ParamID::octaveBlend,      ParamID::character,        ParamID::drive,            ParamID::volume,
+    ParamID::stereoWidth,      ParamID::noiseAmount,      ParamID::crossoverLow,     ParamID::crossoverHigh,
+    ParamID::subCharacter,     ParamID::highCharacter,    ParamID::sidechainAttack,  ParamID::sidechainRelease,
+    ParamID::duckCutoff,       ParamID::duckRingDepth,    ParamID::duckDrive
+};
+
+constexpr int numModulationDestinations = static_cast<int>(modulationDestinations.size());
+
+//==============================================================================
+// What a row takes part in besides the APVTS (bit flags, combined with |)
+namespace ParameterFlags
+{
+    constexpr unsigned NONE   = 0;
+    constexpr unsigned PRESET = 1 << 0;   // Saved in and restored from presets (sound rows, not engine options)
+}
+
+//==============================================================================
+enum class ParameterScale
+{
+    LINEAR,       // Linear with fixed step (interval)
+    LOGARITHMIC,  // start * (end/start)^normalized (perceptually linear for Hz)
+    TOGGLE        // On/off switch (AudioParameterBool, value 0 or 1)
+};
+
+/**
+ * Parameter descriptor (one table row)
+ */
+struct ParameterDescriptor
+{
+    using Formatter = juce::String (*)(float value, int maximumStringLength);
+
+    ParamID paramID;
+    const char* id;
+    const char* name;
+    float minValue;
+    float maxValue;
+    float interval;       // Step size (LINEAR only)
+    ParameterScale scale;
+    float defaultValue;
+    Formatter formatter;
+    unsigned flags;       // ParameterFlags
+};
+
+//==============================================================================
+// Value formatters shared by the table rows
+namespace ParameterFormatters
+{
+    inline juce::String hertz(float value, int)        { return juce::String(value, 1) + " Hz"; }
+    inline juce::String hertzFine(float value, int)    { return juce::String(value, 2) + " Hz"; }
+    inline juce::String percent(float value, int)      { return juce::String(int(value * 100.0f)) + " %"; }
+    inline juce::String milliseconds(float value, int) { return juce::String(value, 1) + " ms"; }
+    inline juce::String onOff(float value, int)        { return value >= 0.5f ? "On" : "Off"; }
+
+    // Modulation routing choices (defined in ModulationMatrix.cpp)
+    juce::String modulationSource(float value, int);
+    juce::String modulationDestination(float value, int);
+
+    inline juce::String decibels(float value, int)
+    {
+        if (value <= -60.0f) return juce::String("-∞ dB");
+        return juce::String(value, 1) + " dB";
+    }
+
+    inline juce::String oversamplingOrder(float value, int)
+    {
+        const int order = juce::roundToInt(value);
+        if (order <= 0) return juce::String("Same as Live");
+        return juce::String(1 << order) + "x Oversampled";
+    }
+
+    inline juce::String filterModel(float value, int)
+    {
+        return juce::roundToInt(value) == 0 ? juce::String("SVF 12dB") : juce::String("Ladder 24dB");
+    }
+}
+
+//==============================================================================
+inline constexpr std::array<ParameterDescriptor, numParameters> parameterTable {{
+    //  ParamID                  ID                  Name                    Min      Max   Step  Scale                        Default  Formatter                                   Flags
+    { ParamID::cutoff,           "cutoff",           "Cutoff",            200.0f, 2000.0f,  0.0f, ParameterScale::LOGARITHMIC,  500.0f, ParameterFormatters::hertz,                  ParameterFlags::PRESET },
+    { ParamID::resonance,        "resonance",        "Resonance",           0.0f,   0.95f, 0.01f, ParameterScale::LINEAR,        0.60f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::ringRate,         "ringRate",         "Ring Mod Rate",       0.5f,   10.0f,  0.0f, ParameterScale::LOGARITHMIC,    3.0f, ParameterFormatters::hertzFine,              ParameterFlags::PRESET },
+    { ParamID::ringDepth,        "ringDepth",        "Ring Mod Depth",      0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,        0.50f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::octaveBlend,      "octaveBlend",      "Octave Blend",        0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,        0.40f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::character,        "character",        "Character",           0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,        0.50f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::drive,            "drive",            "Drive",               0.0f,    2.0f, 0.01f, ParameterScale::LINEAR,         1.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::volume,           "volume",           "Volume",            -60.0f,    6.0f,  0.1f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::decibels,               ParameterFlags::PRESET },
+    { ParamID::stereoWidth,      "stereoWidth",      "Stereo Width",        0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,        0.50f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::noiseAmount,      "noiseAmount",      "Noise Amount",        0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,        0.20f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::multiband,        "multiband",        "Multiband",           0.0f,    1.0f,  1.0f, ParameterScale::TOGGLE,         0.0f, ParameterFormatters::onOff,                  ParameterFlags::PRESET },
+    { ParamID::crossoverLow,     "crossoverLow",     "Sub Crossover",      40.0f,  300.0f,  0.0f, ParameterScale::LOGARITHMIC,  120.0f, ParameterFormatters::hertz,                  ParameterFlags::PRESET },
+    { ParamID::crossoverHigh,    "crossoverHigh",    "High Crossover",    600.0f, 6000.0f,  0.0f, ParameterScale::LOGARITHMIC, 2000.0f, ParameterFormatters::hertz,                  ParameterFlags::PRESET },
+    { ParamID::subCharacter,     "subCharacter",     "Sub Character",       0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::highCharacter,    "highCharacter",    "High Character",      0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,        0.50f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::sidechainAttack,  "sidechainAttack",  "Sidechain Attack",    0.1f,   50.0f,  0.0f, ParameterScale::LOGARITHMIC,    5.0f, ParameterFormatters::milliseconds,           ParameterFlags::PRESET },
+    { ParamID::sidechainRelease, "sidechainRelease", "Sidechain Release",  10.0f, 1000.0f,  0.0f, ParameterScale::LOGARITHMIC,  150.0f, ParameterFormatters::milliseconds,           ParameterFlags::PRESET },
+    { ParamID::sidechainRms,     "sidechainRms",     "Sidechain RMS",       0.0f,    1.0f,  1.0f, ParameterScale::TOGGLE,         0.0f, ParameterFormatters::onOff,                  ParameterFlags::PRESET },
+    { ParamID::duckCutoff,       "duckCutoff",       "Duck Cutoff",         0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::duckRingDepth,    "duckRingDepth",    "Duck Ring Depth",     0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::duckDrive,        "duckDrive",        "Duck Drive",          0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::lfo1Rate,         "lfo1Rate",         "LFO 1 Rate",         0.05f,   20.0f,  0.0f, ParameterScale::LOGARITHMIC,    1.0f, ParameterFormatters::hertzFine,              ParameterFlags::PRESET },
+    { ParamID::lfo2Rate,         "lfo2Rate",         "LFO 2 Rate",         0.05f,   20.0f,  0.0f, ParameterScale::LOGARITHMIC,   0.25f, ParameterFormatters::hertzFine,              ParameterFlags::PRESET },
+    { ParamID::mod1Source,       "mod1Source",       "Mod 1 Source",        0.0f,    5.0f,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::modulationSource,       ParameterFlags::PRESET },
+    { ParamID::mod1Destination,  "mod1Destination",  "Mod 1 Destination",   0.0f, numModulationDestinations,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::modulationDestination,  ParameterFlags::PRESET },
+    { ParamID::mod1Amount,       "mod1Amount",       "Mod 1 Amount",       -1.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::mod2Source,       "mod2Source",       "Mod 2 Source",        0.0f,    5.0f,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::modulationSource,       ParameterFlags::PRESET },
+    { ParamID::mod2Destination,  "mod2Destination",  "Mod 2 Destination",   0.0f, numModulationDestinations,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::modulationDestination,  ParameterFlags::PRESET },
+    { ParamID::mod2Amount,       "mod2Amount",       "Mod 2 Amount",       -1.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::mod3Source,       "mod3Source",       "Mod 3 Source",        0.0f,    5.0f,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::modulationSource,       ParameterFlags::PRESET },
+    { ParamID::mod3Destination,  "mod3Destination",  "Mod 3 Destination",   0.0f, numModulationDestinations,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::modulationDestination,  ParameterFlags::PRESET },
+    { ParamID::mod3Amount,       "mod3Amount",       "Mod 3 Amount",       -1.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::mod4Source,       "mod4Source",       "Mod 4 Source",        0.0f,    5.0f,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::modulationSource,       ParameterFlags::PRESET },
+    { ParamID::mod4Destination,  "mod4Destination",  "Mod 4 Destination",   0.0f, numModulationDestinations,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::modulationDestination,  ParameterFlags::PRESET },
+    { ParamID::mod4Amount,       "mod4Amount",       "Mod 4 Amount",       -1.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+    { ParamID::limiterMode,      "limiterMode",      "True Peak Limiter",   0.0f,    1.0f,  1.0f, ParameterScale::TOGGLE,         0.0f, ParameterFormatters::onOff,                  ParameterFlags::PRESET },
+    { ParamID::limiterLookahead, "limiterLookahead", "Limiter Lookahead",   0.5f,    5.0f,  0.1f, ParameterScale::LINEAR,         1.5f, ParameterFormatters::milliseconds,           ParameterFlags::PRESET },
+    { ParamID::limiterCeiling,   "limiterCeiling",   "Limiter Ceiling",   -12.0f,    0.0f,  0.1f, ParameterScale::LINEAR,        -1.0f, ParameterFormatters::decibels,               ParameterFlags::PRESET },
+    { ParamID::multiCore,        "multiCore",        "Multi-Core",          0.0f,    1.0f,  1.0f, ParameterScale::TOGGLE,         0.0f, ParameterFormatters::onOff,                  ParameterFlags::NONE },
+    { ParamID::offlineQuality,   "offlineQuality",   "Offline Quality",     0.0f,    3.0f,  1.0f, ParameterScale::LINEAR,         2.0f, ParameterFormatters::oversamplingOrder,      ParameterFlags::NONE },
+    { ParamID::stereoLink,       "stereoLink",       "Linked Stereo",       0.0f,    1.0f,  1.0f, ParameterScale::TOGGLE,         0.0f, ParameterFormatters::onOff,                  ParameterFlags::NONE },
+    { ParamID::bypass,           "bypass",           "Bypass",              0.0f,    1.0f,  1.0f, ParameterScale::TOGGLE,         0.0f, ParameterFormatters::onOff,                  ParameterFlags::NONE },
+    { ParamID::filterModel,      "filterModel",      "Filter Model",        0.0f,    1.0f,  1.0f, ParameterScale::LINEAR,         0.0f, ParameterFormatters::filterModel,            ParameterFlags::PRESET },
+    { ParamID::cabinet,          "cabinet",          "Cabinet",             0.0f,    1.0f,  1.0f, ParameterScale::TOGGLE,         0.0f, ParameterFormatters::onOff,                  ParameterFlags::PRESET },
+    { ParamID::cabinetMix,       "cabinetMix",       "Cabinet Mix",         0.0f,    1.0f, 0.01f, ParameterScale::LINEAR,         1.0f, ParameterFormatters::percent,                ParameterFlags::PRESET },
+}};
+
+namespace ParameterTable
+{
+    constexpr bool rowsMatchEnumOrder()
+    {
+        for (std::size_t i = 0; i < parameterTable.size(); ++i)
+            if (toIndex(parameterTable[i].paramID) != i)
+                return false;
+
+        return true;
+    }
+
+    static_assert(rowsMatchEnumOrder(), "parameterTable rows must follow ParamID order");
+
+    constexpr const ParameterDescriptor& get(ParamID id) noexcept
+    {
+        return parameterTable[toIndex(id)];
+    }
+
+    /**
+     * True for rows presets store and restore (loading a preset leaves the others alone)
+     */
+    constexpr bool isPresetParameter(const ParameterDescriptor& descriptor) noexcept
+    {
+        return (descriptor.flags & ParameterFlags::PRESET) != 0;
+    }
+
+    static_assert(!isPresetParameter(get(ParamID::bypass)), "A preset must not bypass the plugin");
+
+    constexpr bool modulationDestinationsAreContinuous()
+    {
+        for (const auto id : modulationDestinations)
+            if (get(id).scale == ParameterScale::TOGGLE || id >= ParamID::lfo1Rate)
+                return false;
+
+        return true;
+    }
+
+    static_assert(modulationDestinationsAreContinuous(),
+                  "Modulation destinations must be continuous sound parameters (an offset cannot move a toggle)");
+
+    /**
+     * Build the normalisable range described by a table row
+     */
+    juce::NormalisableRange<float> makeRange(const ParameterDescriptor& descriptor);
+
+    /**
+     * The value a parameter holds after being set to a real-unit value:
+     * clamped to its range, snapped to its step, toggles to 0 or 1
+     */
+    float constrainValue(const ParameterDescriptor& descriptor, float value);
+
+    /**
+     * Build the complete APVTS layout from the table
+     */
+    juce::AudioProcessorValueTreeState::ParameterLayout createLayout();
+}
+
+//==============================================================================
+/**
+ * Fixed-size parameter value storage indexed by ParamID.
+ * Default-constructs to the table defaults, so no parameter can be missing.
+ */
+struct ParameterValues
+{
+    std::array<float, numParameters> values = makeDefaults();
+
+    float& operator[](ParamID id) noexcept             { return values[toIndex(id)]; }
+    float operator[](ParamID id) const noexcept        { return values[toIndex(id)]; }
+
+    static constexpr std::array<float, numParameters> makeDefaults()
+    {
+        std::array<float, numParameters> defaults {};
+
+        for (std::size_t i = 0; i < parameterTable.size(); ++i)
+            defaults[i] = parameterTable[i].defaultValue;
+
+        return defaults;
+    }
+};
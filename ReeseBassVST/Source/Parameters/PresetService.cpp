@@ -0,0 +1,131 @@
+#include "PresetService.h"
+
+namespace
+{
+    // Preset I/O thread poll interval with nothing queued (requests move it to the front)
+    constexpr int idleInterval = 500;
+}
+
+//==============================================================================
+class PresetService::IOThread : public juce::TimeSliceThread
+{
+public:
+    IOThread() : juce::TimeSliceThread("Reese Preset I/O")
+    {
+        startThread(juce::Thread::Priority::low);
+    }
+
+    ~IOThread() override
+    {
+        stopThread(2000);
+    }
+};
+
+//==============================================================================
+PresetService::PresetService()
+{
+}
+
+PresetService::~PresetService()
+{
+    *alive = false;
+
+    // Waits for a request in progress
+    if (thread.has_value())
+        (*thread)->removeTimeSliceClient(this);
+
+    thread.reset();
+
+    // Nobody is left to hear about them, but the user asked for these files
+    for (auto& request : requests)
+        if (request.presetToSave.has_value())
+            ParameterManager::savePresetToFile(*request.presetToSave, request.file);
+}
+
+//==============================================================================
+void PresetService::load(const juce::File& file, LoadCallback onLoaded)
+{
+    enqueue({ file, std::nullopt, std::move(onLoaded), {} });
+}
+
+void PresetService::save(const ParameterManager::Preset& preset, const juce::File& file, SaveCallback onSaved)
+{
+    enqueue({ file, preset, {}, std::move(onSaved) });
+}
+
+void PresetService::enqueue(Request request)
+{
+    {
+        const juce::ScopedLock scopedLock(lock);
+        requests.push_back(std::move(request));
+    }
+
+    if (!thread.has_value())
+    {
+        thread.emplace();
+        (*thread)->addTimeSliceClient(this);
+    }
+
+    (*thread)->moveToFrontOfQueue(this);
+}
+
+//==============================================================================
+int PresetService::useTimeSlice()
+{
+    Request request;
+
+    {
+        const juce::ScopedLock scopedLock(lock);
+
+        if (requests.empty())
+            return idleInterval;
+
+        request = std::move(requests.front());
+        requests.pop_front();
+    }
+
+    run(request);
+
+    const juce::ScopedLock scopedLock(lock);
+    return requests.empty() ? idleInterval : 0;
+}
+
+void PresetService::run(Request& request)
+{
+    if (request.presetToSave.has_value())
+    {
+        const bool saved = ParameterManager::savePresetToFile(*request.presetToSave, request.file);
+
+        if (request.onSaved != nullptr)
+            juce::MessageManager::callAsync([isAlive = alive, onSaved = std::move(request.onSaved), file = request.file, saved] {
+                if (*isAlive)
+                    onSaved(file, saved);
+            });
+
+        return;
+    }
+
+    auto preset = readPreset(request.file);
+
+    if (request.onLoaded != nullptr)
+        juce::MessageManager::callAsync([isAlive = alive, onLoaded = std::move(request.onLoaded), file = request.file,
+                                         preset = std::move(preset)] {
+            if (*isAlive)
+                onLoaded(file, preset);
+        });
+}
+
+std::optional<ParameterManager::Preset> PresetService::readPreset(const juce::File& file)
+{
+    ParameterManager::Preset preset;
+
+    if (!ParameterManager::loadPresetFromFile(file, preset))
+        return std::nullopt;
+
+    // Compiled here so the audio thread only copies the values
+    for (const auto& descriptor : parameterTable)
+        if (ParameterTable::isPresetParameter(descriptor))
+            preset.parameters[descriptor.paramID] = ParameterTable::constrainValue(descriptor, preset.parameters[descriptor.paramID]);
+
+    return preset;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <juce_events/juce_events.h>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include "ParameterManager.h"
+
+/**
+ * PresetService - Preset Files, Read and Written Off the Message Thread
+ *
+ * Runs ParameterManager's blocking file functions on one process-wide
+ * low-priority thread (started by the first instance that needs it), so a
+ * slow or network-mounted preset folder never stalls the editor:
+ *
+ *   load()/save() ──> queued ──> preset I/O thread: parse and compile / write
+ *   message thread: callback with the result
+ *
+ * Loaded presets arrive compiled: every value already constrained to what
+ * its parameter would hold (ParameterTable::constrainValue), ready for
+ * ReeseDestroyerAudioProcessor::applyPresetAtNextBlock() to copy in one go.
+ *
+ * Requests run in order. Callbacks are dropped once the service is gone;
+ * saves still queued then are written before the destructor returns.
+ */
+class PresetService : private juce::TimeSliceClient
+{
+public:
+    // The preset is empty when the file could not be read
+    using LoadCallback = std::function<void(const juce::File& file, const std::optional<ParameterManager::Preset>& preset)>;
+    using SaveCallback = std::function<void(const juce::File& file, bool saved)>;
+
+    PresetService();
+    ~PresetService() override;
+
+    /**
+     * Read a preset file in the background (message thread; callback on the message thread)
+     */
+    void load(const juce::File& file, LoadCallback onLoaded);
+
+    /**
+     * Write a preset file in the background (message thread; callback on the message thread)
+     */
+    void save(const ParameterManager::Preset& preset, const juce::File& file, SaveCallback onSaved = {});
+
+    /**
+     * Read and compile a preset file on the calling thread (what a background load runs)
+     */
+    static std::optional<ParameterManager::Preset> readPreset(const juce::File& file);
+
+private:
+    //==============================================================================
+    class IOThread;
+
+    struct Request
+    {
+        juce::File file;
+        std::optional<ParameterManager::Preset> presetToSave;   // Empty for loads
+        LoadCallback onLoaded;
+        SaveCallback onSaved;
+    };
+
+    int useTimeSlice() override;
+
+    void enqueue(Request request);
+    void run(Request& request);
+
+    //==============================================================================
+    juce::CriticalSection lock;
+    std::deque<Request> requests;   // Guarded by lock
+    std::optional<juce::SharedResourcePointer<IOThread>> thread;
+
+    // Checked by the callbacks on the message thread, cleared by the destructor there
+    const std::shared_ptr<bool> alive = std::make_shared<bool>(true);
+
+    JUCE_DECLARE_NON_COPYABLE(PresetService)
+};
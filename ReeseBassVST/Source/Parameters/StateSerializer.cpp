@@ -0,0 +1,140 @@
+#include "StateSerializer.h"
+
+namespace
+{
+    // Little-endian helpers (state blobs must be portable between hosts/platforms)
+    void writeUInt32(char*& dest, juce::uint32 value)
+    {
+        value = juce::ByteOrder::swapIfBigEndian(value);
+        std::memcpy(dest, &value, sizeof(value));
+        dest += sizeof(value);
+    }
+
+    void writeUInt16(char*& dest, juce::uint16 value)
+    {
+        value = juce::ByteOrder::swapIfBigEndian(value);
+        std::memcpy(dest, &value, sizeof(value));
+        dest += sizeof(value);
+    }
+
+    juce::uint32 readUInt32(const char* src)
+    {
+        juce::uint32 value;
+        std::memcpy(&value, src, sizeof(value));
+        return juce::ByteOrder::swapIfBigEndian(value);
+    }
+
+    juce::uint16 readUInt16(const char* src)
+    {
+        juce::uint16 value;
+        std::memcpy(&value, src, sizeof(value));
+        return juce::ByteOrder::swapIfBigEndian(value);
+    }
+}
+
+namespace StateSerializer
+{
+
+bool isBinaryState(const void* data, size_t sizeInBytes)
+{
+    return data != nullptr
+        && sizeInBytes >= headerSize
+        && readUInt32(static_cast<const char*>(data)) == magic;
+}
+
+void write(const ParameterValues& values, juce::MemoryBlock& destData,
+           std::initializer_list<Chunk> chunks)
+{
+    const size_t blockSize = static_cast<size_t>(numParameters) * sizeof(float);
+
+    size_t totalSize = headerSize + blockSize;
+    for (const auto& chunk : chunks)
+        totalSize += 8 + chunk.size;
+
+    // Single allocation, no intermediate representation
+    destData.setSize(totalSize, false);
+    auto* dest = static_cast<char*>(destData.getData());
+
+    writeUInt32(dest, magic);
+    writeUInt16(dest, formatVersion);
+    writeUInt16(dest, static_cast<juce::uint16>(numParameters));
+    writeUInt32(dest, static_cast<juce::uint32>(blockSize));
+
+    for (float value : values.values)
+    {
+        juce::uint32 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeUInt32(dest, bits);
+    }
+
+    for (const auto& chunk : chunks)
+    {
+        writeUInt32(dest, chunk.tag);
+        writeUInt32(dest, static_cast<juce::uint32>(chunk.size));
+
+        if (chunk.size > 0)
+            std::memcpy(dest, chunk.data, chunk.size);
+
+        dest += chunk.size;
+    }
+}
+
+bool read(const void* data, size_t sizeInBytes, ParameterValues& values,
+          const ChunkHandler& onChunk)
+{
+    if (!isBinaryState(data, sizeInBytes))
+        return false;
+
+    const auto* src = static_cast<const char*>(data);
+    const auto* end = src + sizeInBytes;
+
+    const auto version = readUInt16(src + 4);
+    const auto storedParameters = readUInt16(src + 6);
+    const auto blockSize = readUInt32(src + 8);
+
+    // Future major versions may change the header; refuse rather than misread
+    if (version == 0 || version > formatVersion)
+        return false;
+
+    if (blockSize != storedParameters * sizeof(float)
+        || blockSize > sizeInBytes - headerSize)
+        return false;
+
+    src += headerSize;
+
+    // Load the prefix both sides know about; anything else keeps its value
+    const int numToRead = juce::jmin(static_cast<int>(storedParameters), numParameters);
+
+    for (int i = 0; i < numToRead; ++i)
+    {
+        const auto bits = readUInt32(src + i * sizeof(float));
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        // Never let a corrupt blob push NaN/Inf into the parameter tree
+        if (std::isfinite(value))
+            values.values[static_cast<size_t>(i)] = value;
+    }
+
+    src += blockSize;
+
+    // Walk extension chunks, skipping unknown tags
+    while (end - src >= 8)
+    {
+        const auto tag = readUInt32(src);
+        const auto size = readUInt32(src + 4);
+        src += 8;
+
+        if (size > static_cast<size_t>(end - src))
+            break;   // Truncated chunk: keep what we have
+
+        if (onChunk)
+            onChunk(tag, src, size);
+
+        src += size;
+    }
+
+    return true;
+}
+
+} // namespace StateSerializer
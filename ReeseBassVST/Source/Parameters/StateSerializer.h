@@ -0,0 +1,72 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <functional>
+#include "ParameterTable.h"
+
+/**
+ * StateSerializer - Compact Binary Plugin State
+ *
+ * Replaces the ValueTree -> XML -> binary round trip for host state with a
+ * versioned, fixed-layout binary format that loads without any parsing:
+ *
+ *   Header (12 bytes, little-endian)
+ *     uint32 magic          'RDst'
+ *     uint16 version        formatVersion
+ *     uint16 numParameters  parameters stored in the block below
+ *     uint32 blockSize      numParameters * 4
+ *   Parameter block
+ *     float32 values[numParameters]   real (denormalized) values in ParamID order
+ *   Extension chunks (optional, repeated until end of data)
+ *     uint32 tag
+ *     uint32 size
+ *     uint8  data[size]
+ *
+ * Compatibility rules:
+ * - The parameter table is append-only, so an older blob with fewer
+ *   parameters loads its prefix and the rest keep their table defaults.
+ * - A newer blob with more parameters loads the known prefix and ignores the rest.
+ * - Unknown extension chunks are skipped.
+ * - Blobs without the magic (legacy XML state) are left to the caller.
+ */
+namespace StateSerializer
+{
+    constexpr juce::uint32 magic = 0x74734452;   // 'RDst'
+    constexpr juce::uint16 formatVersion = 1;
+    constexpr size_t headerSize = 12;
+
+    /**
+     * Optional extension chunk appended after the parameter block
+     */
+    struct Chunk
+    {
+        juce::uint32 tag = 0;
+        const void* data = nullptr;
+        size_t size = 0;
+    };
+
+    /**
+     * Callback invoked for each extension chunk found while reading
+     */
+    using ChunkHandler = std::function<void(juce::uint32 tag, const void* data, size_t size)>;
+
+    /**
+     * Check whether a state blob uses the binary format
+     */
+    bool isBinaryState(const void* data, size_t sizeInBytes);
+
+    /**
+     * Serialize parameter values (and optional chunks) into destData
+     */
+    void write(const ParameterValues& values, juce::MemoryBlock& destData,
+               std::initializer_list<Chunk> chunks = {});
+
+    /**
+     * Deserialize a binary state blob
+     * @param values Receives stored values; parameters absent from the blob keep their current value
+     * @param onChunk Optional handler for extension chunks
+     * @return False if the blob is not a valid binary state
+     */
+    bool read(const void* data, size_t sizeInBytes, ParameterValues& values,
+              const ChunkHandler& onChunk = {});
+}
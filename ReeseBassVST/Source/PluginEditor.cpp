@@ -1,27 +1,183 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+namespace
+{
+    constexpr int editorWidth = 560;
+    constexpr int analysisHeight = 180;
+    constexpr int responseHeight = 120;
+    constexpr int cabinetHeight = 28;
+    constexpr int presetHeight = 28;
+
+    juce::File getPresetDirectory()
+    {
+        return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+            .getChildFile("Reese Destroyer").getChildFile("Presets");
+    }
+}
+
 //==============================================================================
 ReeseDestroyerAudioProcessorEditor::ReeseDestroyerAudioProcessorEditor(ReeseDestroyerAudioProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p),
+      parameterControls(p),
+      analysisView(p.getAnalysisTap()),
+      filterResponseView(p.getFilterResponse(), p.getParameters())
 {
-    setSize(400, 300);
+    addAndMakeVisible(parameterControls);
+    addAndMakeVisible(analysisView);
+    addAndMakeVisible(filterResponseView);
+
+    loadCabinetButton.onClick = [this] { chooseCabinetFile(); };
+    clearCabinetButton.onClick = [this] { audioProcessor.getCabinetLoader().clear(); };
+    addAndMakeVisible(loadCabinetButton);
+    addAndMakeVisible(clearCabinetButton);
+    addAndMakeVisible(cabinetLabel);
+
+    audioProcessor.getCabinetLoader().addChangeListener(this);
+    updateCabinetLabel();
+
+    loadPresetButton.onClick = [this] { choosePresetToLoad(); };
+    savePresetButton.onClick = [this] { choosePresetToSave(); };
+    addAndMakeVisible(loadPresetButton);
+    addAndMakeVisible(savePresetButton);
+    addAndMakeVisible(presetLabel);
+    presetLabel.setText("No preset file", juce::dontSendNotification);
+
+    undoButton.onClick = [this] { audioProcessor.getParameterHistory().undo(); };
+    redoButton.onClick = [this] { audioProcessor.getParameterHistory().redo(); };
+    addAndMakeVisible(undoButton);
+    addAndMakeVisible(redoButton);
+
+    audioProcessor.getParameterHistory().addChangeListener(this);
+    updateHistoryButtons();
+
+    setSize(editorWidth, analysisHeight + responseHeight + presetHeight + cabinetHeight + parameterControls.getHeight());
 }
 
 ReeseDestroyerAudioProcessorEditor::~ReeseDestroyerAudioProcessorEditor()
 {
+    audioProcessor.getCabinetLoader().removeChangeListener(this);
+    audioProcessor.getParameterHistory().removeChangeListener(this);
+}
+
+//==============================================================================
+void ReeseDestroyerAudioProcessorEditor::chooseCabinetFile()
+{
+    cabinetChooser = std::make_unique<juce::FileChooser>("Load Cabinet IR", audioProcessor.getCabinetLoader().getFile(),
+                                                         "*.wav;*.aif;*.aiff;*.flac");
+
+    cabinetChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+                                [this](const juce::FileChooser& chooser) {
+                                    if (chooser.getResult() != juce::File())
+                                        audioProcessor.getCabinetLoader().load(chooser.getResult());
+
+                                    updateCabinetLabel();
+                                });
+}
+
+void ReeseDestroyerAudioProcessorEditor::choosePresetToLoad()
+{
+    getPresetDirectory().createDirectory();
+    presetChooser = std::make_unique<juce::FileChooser>("Load Preset", getPresetDirectory(), "*.xml");
+
+    presetChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+                               [this](const juce::FileChooser& chooser) {
+                                   const auto file = chooser.getResult();
+                                   if (file == juce::File())
+                                       return;
+
+                                   presetLabel.setText(file.getFileNameWithoutExtension() + " (loading)", juce::dontSendNotification);
+
+                                   // The processor outlives the service's callbacks; this editor may not
+                                   auto& processor = audioProcessor;
+                                   juce::Component::SafePointer<juce::Label> label(&presetLabel);
+
+                                   processor.getPresetService().load(file, [&processor, label](const juce::File& loaded, const auto& preset) {
+                                       if (preset.has_value())
+                                           processor.applyPresetAtNextBlock(preset->parameters);
+
+                                       if (label != nullptr)
+                                           label->setText(preset.has_value() ? preset->name : loaded.getFileName() + " (could not be read)",
+                                                          juce::dontSendNotification);
+                                   });
+                               });
+}
+
+void ReeseDestroyerAudioProcessorEditor::choosePresetToSave()
+{
+    getPresetDirectory().createDirectory();
+    presetChooser = std::make_unique<juce::FileChooser>("Save Preset", getPresetDirectory(), "*.xml");
+
+    presetChooser->launchAsync(juce::FileBrowserComponent::saveMode | juce::FileBrowserComponent::canSelectFiles
+                                 | juce::FileBrowserComponent::warnAboutOverwriting,
+                               [this](const juce::FileChooser& chooser) {
+                                   if (chooser.getResult() == juce::File())
+                                       return;
+
+                                   const auto file = chooser.getResult().withFileExtension("xml");
+
+                                   const auto preset = ParameterManager::createPresetFromCurrentState(
+                                       audioProcessor.getParameters(), file.getFileNameWithoutExtension(), {});
+                                   juce::Component::SafePointer<juce::Label> label(&presetLabel);
+
+                                   audioProcessor.getPresetService().save(preset, file, [label](const juce::File& saved, bool succeeded) {
+                                       if (label != nullptr)
+                                           label->setText(saved.getFileNameWithoutExtension() + (succeeded ? "" : " (could not be saved)"),
+                                                          juce::dontSendNotification);
+                                   });
+                               });
+}
+
+void ReeseDestroyerAudioProcessorEditor::changeListenerCallback(juce::ChangeBroadcaster* source)
+{
+    if (source == &audioProcessor.getParameterHistory())
+        updateHistoryButtons();
+    else
+        updateCabinetLabel();
+}
+
+void ReeseDestroyerAudioProcessorEditor::updateHistoryButtons()
+{
+    undoButton.setEnabled(audioProcessor.getParameterHistory().canUndo());
+    redoButton.setEnabled(audioProcessor.getParameterHistory().canRedo());
+}
+
+void ReeseDestroyerAudioProcessorEditor::updateCabinetLabel()
+{
+    const auto& loader = audioProcessor.getCabinetLoader();
+    const auto name = loader.getFile().getFileName();
+
+    switch (loader.getStatus())
+    {
+        case CabinetLoader::Status::EMPTY:   cabinetLabel.setText("No cabinet IR", juce::dontSendNotification); break;
+        case CabinetLoader::Status::LOADING: cabinetLabel.setText(name + " (loading)", juce::dontSendNotification); break;
+        case CabinetLoader::Status::READY:   cabinetLabel.setText(name, juce::dontSendNotification); break;
+        case CabinetLoader::Status::FAILED:  cabinetLabel.setText(name + " (could not be read)", juce::dontSendNotification); break;
+    }
 }
 
 //==============================================================================
 void ReeseDestroyerAudioProcessorEditor::paint(juce::Graphics& g)
 {
     g.fillAll(getLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId));
-
-    g.setColour(juce::Colours::white);
-    g.setFont(15.0f);
-    g.drawFittedText("Reese Destroyer", getLocalBounds(), juce::Justification::centred, 1);
 }
 
 void ReeseDestroyerAudioProcessorEditor::resized()
 {
+    auto area = getLocalBounds();
+    analysisView.setBounds(area.removeFromTop(analysisHeight));
+    filterResponseView.setBounds(area.removeFromTop(responseHeight));
+
+    auto presetRow = area.removeFromTop(presetHeight).reduced(4, 2);
+    loadPresetButton.setBounds(presetRow.removeFromLeft(140));
+    savePresetButton.setBounds(presetRow.removeFromLeft(60).withTrimmedLeft(4));
+    redoButton.setBounds(presetRow.removeFromRight(60).withTrimmedLeft(4));
+    undoButton.setBounds(presetRow.removeFromRight(56));
+    presetLabel.setBounds(presetRow.withTrimmedLeft(8));
+
+    auto cabinetRow = area.removeFromTop(cabinetHeight).reduced(4, 2);
+    loadCabinetButton.setBounds(cabinetRow.removeFromLeft(140));
+    clearCabinetButton.setBounds(cabinetRow.removeFromLeft(60).withTrimmedLeft(4));
+    cabinetLabel.setBounds(cabinetRow.withTrimmedLeft(8));
+    parameterControls.setBounds(area);
 }
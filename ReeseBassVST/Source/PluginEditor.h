@@ -3,15 +3,19 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "PluginProcessor.h"
+#include "GUI/AnalysisView.h"
+#include "GUI/FilterResponseView.h"
 
 //==============================================================================
 /**
  * Reese Destroyer Plugin Editor
  *
  * Future: Will implement skeuomorphic analog pedal GUI
- * Current: Using generic editor for development
+ * Current: Generic parameter controls, metering/spectrum analysis view, preset
+ *          files, undo/redo and the cabinet IR file
  */
-class ReeseDestroyerAudioProcessorEditor : public juce::AudioProcessorEditor
+class ReeseDestroyerAudioProcessorEditor : public juce::AudioProcessorEditor,
+                                           private juce::ChangeListener
 {
 public:
     ReeseDestroyerAudioProcessorEditor(ReeseDestroyerAudioProcessor&);
@@ -22,7 +26,34 @@ public:
     void resized() override;
 
 private:
+    // Cabinet IR file status (the loader broadcasts when a load finishes) and the
+    // undo/redo buttons (the parameter history broadcasts when it changes)
+    void changeListenerCallback(juce::ChangeBroadcaster*) override;
+    void updateHistoryButtons();
+    void updateCabinetLabel();
+    void chooseCabinetFile();
+
+    // Preset files (read and written in the background, see PresetService)
+    void choosePresetToLoad();
+    void choosePresetToSave();
+
     ReeseDestroyerAudioProcessor& audioProcessor;
 
+    juce::TextButton loadCabinetButton { "Load Cabinet IR..." };
+    juce::TextButton clearCabinetButton { "Clear" };
+    juce::Label cabinetLabel;
+    std::unique_ptr<juce::FileChooser> cabinetChooser;
+
+    juce::TextButton loadPresetButton { "Load Preset..." };
+    juce::TextButton savePresetButton { "Save..." };
+    juce::Label presetLabel;
+    juce::TextButton undoButton { "Undo" };
+    juce::TextButton redoButton { "Redo" };
+    std::unique_ptr<juce::FileChooser> presetChooser;
+
+    juce::GenericAudioProcessorEditor parameterControls;
+    AnalysisView analysisView;
+    FilterResponseView filterResponseView;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReeseDestroyerAudioProcessorEditor)
 };
@@ -1,5 +1,8 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "Threading/AudioThreadGuard.h"
+#include "Profiling/StageTrace.h"
+#include <random>
 
 //==============================================================================
 ReeseDestroyerAudioProcessor::ReeseDestroyerAudioProcessor()
@@ -8,6 +11,7 @@ ReeseDestroyerAudioProcessor::ReeseDestroyerAudioProcessor()
                      #if !JucePlugin_IsMidiEffect
                       #if !JucePlugin_IsSynth
                        .withInput("Input", juce::AudioChannelSet::stereo(), true)
+                       .withInput("Sidechain", juce::AudioChannelSet::stereo(), false)
                       #endif
                        .withOutput("Output", juce::AudioChannelSet::stereo(), true)
                      #endif
@@ -16,153 +20,29 @@ ReeseDestroyerAudioProcessor::ReeseDestroyerAudioProcessor()
       parameters(*this, nullptr, juce::Identifier("ReeseDestroyer"), createParameterLayout())
 {
     // Get parameter pointers for real-time access
-    cutoffParam = parameters.getRawParameterValue("cutoff");
-    resonanceParam = parameters.getRawParameterValue("resonance");
-    ringRateParam = parameters.getRawParameterValue("ringRate");
-    ringDepthParam = parameters.getRawParameterValue("ringDepth");
-    octaveBlendParam = parameters.getRawParameterValue("octaveBlend");
-    characterParam = parameters.getRawParameterValue("character");
-    driveParam = parameters.getRawParameterValue("drive");
-    volumeParam = parameters.getRawParameterValue("volume");
-    stereoWidthParam = parameters.getRawParameterValue("stereoWidth");
-    noiseAmountParam = parameters.getRawParameterValue("noiseAmount");
+    for (const auto& descriptor : parameterTable)
+    {
+        const auto index = toIndex(descriptor.paramID);
+        parameterValues[index] = parameters.getRawParameterValue(descriptor.id);
+        parameterObjects[index] = parameters.getParameter(descriptor.id);
+        jassert(parameterValues[index] != nullptr && parameterObjects[index] != nullptr);
+    }
+
+    parameters.addParameterListener(ParameterTable::get(ParamID::multiCore).id, this);
 }
 
 ReeseDestroyerAudioProcessor::~ReeseDestroyerAudioProcessor()
 {
+    parameters.removeParameterListener(ParameterTable::get(ParamID::multiCore).id, this);
+    cancelPendingUpdate();
+    stopTimer();
 }
 
 //==============================================================================
 juce::AudioProcessorValueTreeState::ParameterLayout ReeseDestroyerAudioProcessor::createParameterLayout()
 {
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    // CUTOFF: 200-2000Hz (logarithmic)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "cutoff",
-        "Cutoff",
-        juce::NormalisableRange<float>(200.0f, 2000.0f,
-            [](float start, float end, float normalized) {
-                return start * std::pow(end / start, normalized);
-            },
-            [](float start, float end, float value) {
-                return std::log(value / start) / std::log(end / start);
-            }),
-        500.0f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " Hz"; }
-    ));
-
-    // RESONANCE: 0-95%
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "resonance",
-        "Resonance",
-        juce::NormalisableRange<float>(0.0f, 0.95f, 0.01f),
-        0.60f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(int(value * 100.0f)) + " %"; }
-    ));
-
-    // RING MOD RATE: 0.5-10Hz (logarithmic)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "ringRate",
-        "Ring Mod Rate",
-        juce::NormalisableRange<float>(0.5f, 10.0f,
-            [](float start, float end, float normalized) {
-                return start * std::pow(end / start, normalized);
-            },
-            [](float start, float end, float value) {
-                return std::log(value / start) / std::log(end / start);
-            }),
-        3.0f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 2) + " Hz"; }
-    ));
-
-    // RING MOD DEPTH: 0-100%
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "ringDepth",
-        "Ring Mod Depth",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
-        0.50f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(int(value * 100.0f)) + " %"; }
-    ));
-
-    // OCTAVE BLEND: 0-100%
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "octaveBlend",
-        "Octave Blend",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
-        0.40f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(int(value * 100.0f)) + " %"; }
-    ));
-
-    // CHARACTER: 0-100%
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "character",
-        "Character",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
-        0.50f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(int(value * 100.0f)) + " %"; }
-    ));
-
-    // DRIVE: 0-200%
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "drive",
-        "Drive",
-        juce::NormalisableRange<float>(0.0f, 2.0f, 0.01f),
-        1.0f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(int(value * 100.0f)) + " %"; }
-    ));
-
-    // VOLUME: -∞ to +6dB
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "volume",
-        "Volume",
-        juce::NormalisableRange<float>(-60.0f, 6.0f, 0.1f),
-        0.0f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) {
-            if (value <= -60.0f) return juce::String("-∞ dB");
-            return juce::String(value, 1) + " dB";
-        }
-    ));
-
-    // STEREO WIDTH: 0-100% (internal parameter)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "stereoWidth",
-        "Stereo Width",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
-        0.50f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(int(value * 100.0f)) + " %"; }
-    ));
-
-    // NOISE AMOUNT: 0-100% (internal parameter)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        "noiseAmount",
-        "Noise Amount",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
-        0.20f,
-        juce::String(),
-        juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(int(value * 100.0f)) + " %"; }
-    ));
-
-    return layout;
+    // All parameters (IDs, ranges, defaults, formatters) live in parameterTable
+    return ParameterTable::createLayout();
 }
 
 //==============================================================================
@@ -200,7 +80,8 @@ bool ReeseDestroyerAudioProcessor::isMidiEffect() const
 
 double ReeseDestroyerAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0; // No tail (not a reverb/delay)
+    // No tail of its own (not a reverb/delay); the cabinet IR rings on for its length
+    return getParameterValue(ParamID::cabinet) >= 0.5f ? cabinetLoader.getLengthSeconds() : 0.0;
 }
 
 int ReeseDestroyerAudioProcessor::getNumPrograms()
@@ -245,58 +126,236 @@ void ReeseDestroyerAudioProcessor::changeProgramName(int index, const juce::Stri
 //==============================================================================
 void ReeseDestroyerAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    // Initialize all DSP modules with sample rate
-    leftChannel.octaveDivider.prepare(sampleRate);
-    rightChannel.octaveDivider.prepare(sampleRate);
-
-    leftChannel.ringModulator.prepare(sampleRate);
-    rightChannel.ringModulator.prepare(sampleRate);
-
-    leftChannel.filter1.prepare(sampleRate);
-    rightChannel.filter1.prepare(sampleRate);
-    leftChannel.filter2.prepare(sampleRate);
-    rightChannel.filter2.prepare(sampleRate);
-    leftChannel.filter3.prepare(sampleRate);
-    rightChannel.filter3.prepare(sampleRate);
-
-    leftChannel.waveShaper.prepare(sampleRate);
-    rightChannel.waveShaper.prepare(sampleRate);
-
-    leftChannel.noiseGen.prepare(sampleRate);
-    rightChannel.noiseGen.prepare(sampleRate);
-
-    // Initialize parameter smoothing (50ms ramp time)
-    const double rampTime = 0.05;
-    smoothedCutoff.reset(sampleRate, rampTime);
-    smoothedResonance.reset(sampleRate, rampTime);
-    smoothedRingRate.reset(sampleRate, rampTime);
-    smoothedRingDepth.reset(sampleRate, rampTime);
-    smoothedOctaveBlend.reset(sampleRate, rampTime);
-    smoothedCharacter.reset(sampleRate, rampTime);
-    smoothedDrive.reset(sampleRate, rampTime);
-    smoothedVolume.reset(sampleRate, rampTime);
-    smoothedStereoWidth.reset(sampleRate, rampTime);
-    smoothedNoiseAmount.reset(sampleRate, rampTime);
-
-    // Set initial values
-    smoothedCutoff.setCurrentAndTargetValue(cutoffParam->load());
-    smoothedResonance.setCurrentAndTargetValue(resonanceParam->load());
-    smoothedRingRate.setCurrentAndTargetValue(ringRateParam->load());
-    smoothedRingDepth.setCurrentAndTargetValue(ringDepthParam->load());
-    smoothedOctaveBlend.setCurrentAndTargetValue(octaveBlendParam->load());
-    smoothedCharacter.setCurrentAndTargetValue(characterParam->load());
-    smoothedDrive.setCurrentAndTargetValue(driveParam->load());
-    smoothedVolume.setCurrentAndTargetValue(volumeParam->load());
-    smoothedStereoWidth.setCurrentAndTargetValue(stereoWidthParam->load());
-    smoothedNoiseAmount.setCurrentAndTargetValue(noiseAmountParam->load());
-
-    // Report zero latency
-    setLatencySamples(0);
+    preparedBlockSize = juce::jmax(samplesPerBlock, 1);
+
+    // Oversamplers for every Offline Quality setting, so switching never allocates
+    const int numProcessChannels = juce::jlimit(1, maxChannels, getTotalNumOutputChannels());
+
+    if (numProcessChannels != oversamplerChannels || preparedBlockSize != oversamplerBlockSize)
+    {
+        for (int order = 1; order <= maxOversamplingOrder; ++order)
+        {
+            auto& oversampler = oversamplers[static_cast<size_t>(order - 1)];
+            oversampler = std::make_unique<juce::dsp::Oversampling<float>>(
+                static_cast<size_t>(numProcessChannels), static_cast<size_t>(order),
+                juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true, true);
+            oversampler->initProcessing(static_cast<size_t>(preparedBlockSize));
+        }
+
+        oversamplerChannels = numProcessChannels;
+        oversamplerBlockSize = preparedBlockSize;
+    }
+
+    if (!chainsSeeded)
+        seedChains();
+
+    if (decibelTable == nullptr)
+        decibelTable = SharedTables::acquire(SharedTables::Type::DECIBELS_TO_GAIN);
+
+    // The sidechain is read at the host rate whatever the processing rate
+    sidechainFollower.prepare(sampleRate);
+
+    // Smoothers at their values and everything that runs at the processing rate
+    restartProcessing();
+
+    profileFade.reset(sampleRate, profileFadeTime);
+    profileFade.setCurrentAndTargetValue(1.0f);
+
+    // Pre-spawn the Multi-Core worker if it is on (or already running, to update its spin time)
+    workerAllowed = getTotalNumOutputChannels() > 1;
+
+    if (!workerAllowed)
+        channelWorker.stop();
+    else if (getParameterValue(ParamID::multiCore) >= 0.5f || channelWorker.isReady())
+        startChannelWorker();
+
+    analysisTap.prepare(sampleRate);
+    filterResponse.setSampleRate(sampleRate);
+
+    // Latency: zero for the soft knee, the lookahead for the true-peak limiter
+    outputLimiter.prepare(sampleRate);
+    truePeakWasActive = false;
+    latencySettleSamples = juce::roundToInt(latencySettleTime * sampleRate);
+    updateOutputStage(0);
+    setLatencySamples(currentLatency);
+
+    // Bypass: the dry path is delayed by up to the longest latency any setting reports
+    int maxOversamplingLatency = 0;
+    for (const auto& oversampler : oversamplers)
+        maxOversamplingLatency = juce::jmax(maxOversamplingLatency, juce::roundToInt(oversampler->getLatencyInSamples()));
+
+    dryDelay.prepare(maxOversamplingLatency + outputLimiter.getMaxLatencySamples(), preparedBlockSize);
+    dryBuffer.setSize(maxChannels, preparedBlockSize);
+
+    bypassMix.reset(sampleRate, bypassFadeTime);
+    bypassMix.setCurrentAndTargetValue(getParameterValue(ParamID::bypass) >= 0.5f ? 0.0f : 1.0f);
+    bypassAsleep = false;
+
+    // Cabinet at the host rate (builds now if the rate changed or a file is still loading)
+    cabinetLoader.prepare(sampleRate);
+    cabinetDry.setSize(maxChannels, preparedBlockSize);
+    cabinetMix.reset(sampleRate, cabinetFadeTime);
+    cabinetMix.setCurrentAndTargetValue(getParameterValue(ParamID::cabinet) >= 0.5f
+                                            ? getParameterValue(ParamID::cabinetMix) : 0.0f);
+}
+
+void ReeseDestroyerAudioProcessor::restartProcessing()
+{
+    // Initialize parameter smoothing and set initial values (ramp lengths follow the profile)
+    for (const auto& descriptor : parameterTable)
+        smoothed(descriptor.paramID).setCurrentAndTargetValue(getParameterValue(descriptor.paramID));
+
+    for (auto* factor : { &ducking.cutoff, &ducking.ringDepth, &ducking.drive })
+        factor->setCurrentAndTargetValue(1.0f);
+
+    modulationMatrix.updateRoutings(parameterValues);
+
+    // The convolvers restart from silence the next time the cabinet runs
+    cabinetRunning = false;
+
+    // Everything that runs at the processing rate
+    applyProcessingProfile(selectProcessingProfile());
+}
+
+//==============================================================================
+ReeseDestroyerAudioProcessor::ProcessingProfile ReeseDestroyerAudioProcessor::selectProcessingProfile() const
+{
+    static_assert(ParameterTable::get(ParamID::offlineQuality).maxValue == static_cast<float>(maxOversamplingOrder),
+                  "Offline Quality range must match the prepared oversamplers");
+
+    const int order = juce::jlimit(0, maxOversamplingOrder,
+                                   juce::roundToInt(getParameterValue(ParamID::offlineQuality)));
+
+    if (!isNonRealtime() || order == 0)
+        return liveProfile;
+
+    // Offline: oversampled chains, control rate evaluated every sample
+    return { order, 1 };
+}
+
+void ReeseDestroyerAudioProcessor::applyProcessingProfile(const ProcessingProfile& profile)
+{
+    activeProfile = profile;
+
+    activeOversampler = profile.oversamplingOrder > 0
+                      ? oversamplers[static_cast<size_t>(profile.oversamplingOrder - 1)].get()
+                      : nullptr;
+
+    oversamplingLatency = 0;
+
+    if (activeOversampler != nullptr)
+    {
+        activeOversampler->reset();
+        oversamplingLatency = juce::roundToInt(activeOversampler->getLatencyInSamples());
+    }
+
+    processingRate = getSampleRate() * static_cast<double>(1 << profile.oversamplingOrder);
+    controlBlockPhase = 0;
+
+    // Module prepare() only stores the rate and resets state (no allocation),
+    // so this is safe on the audio thread
+    for (auto& channelChains : chains)
+    {
+        channelChains.main.prepare(processingRate);
+        channelChains.sub.prepare(processingRate);
+        channelChains.high.prepare(processingRate);
+    }
+
+    crossover.prepare(processingRate);
+    multibandWasActive = false;
+    chunkSharing = StereoSharing::NONE;   // Every chain starts from the same (reset) state
+
+    ringLfoTracker.prepare(processingRate);
+    ringLfoTracked = false;
+
+    inputFollower.prepare(processingRate);
+    modulationMatrix.prepare(processingRate);
+
+    // Ducking ramps over one control block
+    for (auto* factor : { &ducking.cutoff, &ducking.ringDepth, &ducking.drive })
+        factor->reset(profile.controlInterval);
+
+    updateSmoothingTimes();
+}
+
+bool ReeseDestroyerAudioProcessor::updateOutputStage(int numSamples)
+{
+    const bool useTruePeakLimiter = getParameterValue(ParamID::limiterMode) >= 0.5f;
+
+    outputLimiter.setLookahead(getParameterValue(ParamID::limiterLookahead));
+    outputLimiter.setCeiling(getParameterValue(ParamID::limiterCeiling));
+
+    // Re-entering true-peak mode: do not replay stale audio from the delay line
+    if (useTruePeakLimiter && !truePeakWasActive)
+        outputLimiter.reset();
+
+    truePeakWasActive = useTruePeakLimiter;
+
+    // The limiter follows lookahead automation at once; the host hears about the
+    // new latency when it stops moving
+    const int latency = oversamplingLatency + (useTruePeakLimiter ? outputLimiter.getLatencySamples() : 0);
+
+    if (latency != currentLatency)
+    {
+        currentLatency = latency;
+        currentLatencyAge = 0;
+    }
+    else
+    {
+        currentLatencyAge = juce::jmin(currentLatencyAge + numSamples, latencySettleSamples);
+    }
+
+    if (latency != getLatencySamples() && currentLatencyAge >= latencySettleSamples)
+        setLatencySamples(latency);
+
+    return useTruePeakLimiter;
 }
 
 void ReeseDestroyerAudioProcessor::releaseResources()
 {
     // Release any resources when playback stops
+    workerAllowed = false;
+    channelWorker.stop();
+}
+
+//==============================================================================
+void ReeseDestroyerAudioProcessor::seedChains()
+{
+   #if !REESE_DETERMINISTIC_NOISE
+    // One entropy source per instance, drawn once per chain
+    std::random_device entropy;
+
+    for (auto& channelChains : chains)
+        for (auto* chain : { &channelChains.main, &channelChains.sub, &channelChains.high })
+            chain->seed(entropy());
+   #endif
+
+    chainsSeeded = true;
+}
+
+void ReeseDestroyerAudioProcessor::startChannelWorker()
+{
+    if (workerAllowed)
+        channelWorker.start(preparedBlockSize, getSampleRate());
+}
+
+void ReeseDestroyerAudioProcessor::parameterChanged(const juce::String&, float newValue)
+{
+    // Multi-Core switched on after prepareToPlay. Until the worker runs the
+    // channels are processed serially. Automation can arrive on the audio thread
+    if (newValue < 0.5f || channelWorker.isReady())
+        return;
+
+    if (juce::MessageManager::existsAndIsCurrentThread())
+        startChannelWorker();
+    else
+        triggerAsyncUpdate();
+}
+
+void ReeseDestroyerAudioProcessor::handleAsyncUpdate()
+{
+    if (getParameterValue(ParamID::multiCore) >= 0.5f)
+        startChannelWorker();
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -315,6 +374,17 @@ bool ReeseDestroyerAudioProcessor::isBusesLayoutSupported(const BusesLayout& lay
    #if !JucePlugin_IsSynth
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
         return false;
+
+    // Optional sidechain: disabled, mono or stereo
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto sidechain = layouts.getChannelSet(true, 1);
+
+        if (!sidechain.isDisabled()
+         && sidechain != juce::AudioChannelSet::mono()
+         && sidechain != juce::AudioChannelSet::stereo())
+            return false;
+    }
    #endif
 
     return true;
@@ -325,159 +395,724 @@ bool ReeseDestroyerAudioProcessor::isBusesLayoutSupported(const BusesLayout& lay
 void ReeseDestroyerAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ignoreUnused(midiMessages);
+    swapInStagedPreset();
+    processSegments(buffer, getParameterValue(ParamID::bypass) >= 0.5f);
+}
+
+void ReeseDestroyerAudioProcessor::processBlockBypassed(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    // Hosts that bypass without the Bypass parameter: the same fade, to the latency-aligned input
+    juce::ignoreUnused(midiMessages);
+    swapInStagedPreset();
+    processSegments(buffer, true);
+}
+
+juce::AudioProcessorParameter* ReeseDestroyerAudioProcessor::getBypassParameter() const
+{
+    return parameterObjects[toIndex(ParamID::bypass)];
+}
+
+void ReeseDestroyerAudioProcessor::processSegments(juce::AudioBuffer<float>& buffer, bool bypassed)
+{
     juce::ScopedNoDenormals noDenormals;
 
-    auto totalNumInputChannels  = getTotalNumInputChannels();
+    // Test builds: flag any allocation or lock from here on (no-op otherwise)
+    const AudioThreadGuard::ScopedAudioThread audioThreadScope;
+
+    // Trace builds: per-stage timing (no-op otherwise)
+    const StageTrace::Scope blockTrace(StageTrace::Stage::BLOCK);
+
+    // Shared tables are acquired in prepareToPlay()
+    jassert(decibelTable != nullptr);
+    if (decibelTable == nullptr)
+        return;
+
+    // The oversamplers and the dry buffer are sized for the prepared block size, so split
+    // longer host blocks (views into the host buffer: no allocation up to 32 channels)
+    const int numSamples = buffer.getNumSamples();
+
+    for (int offset = 0; offset < numSamples; offset += preparedBlockSize)
+    {
+        juce::AudioBuffer<float> segment(buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                                         offset, juce::jmin(preparedBlockSize, numSamples - offset));
+        processSegment(segment, bypassed);
+    }
+}
+
+void ReeseDestroyerAudioProcessor::processSegment(juce::AudioBuffer<float>& buffer, bool bypassed)
+{
+    // Main bus only: the sidechain channels follow it in the same buffer
+    auto totalNumInputChannels  = getMainBusNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
+    const int numSamples = buffer.getNumSamples();
+    const int numProcessChannels = juce::jlimit(1, maxChannels, totalNumOutputChannels);
+
+    const bool hasSidechain = getBusCount(true) > 1 && getChannelCountOfBus(true, 1) > 0;
+    const auto sidechain = hasSidechain ? getBusBuffer(buffer, true, 1) : juce::AudioBuffer<float>();
 
     // Clear any extra output channels
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    // Update target values for parameter smoothing
-    smoothedCutoff.setTargetValue(cutoffParam->load());
-    smoothedResonance.setTargetValue(resonanceParam->load());
-    smoothedRingRate.setTargetValue(ringRateParam->load());
-    smoothedRingDepth.setTargetValue(ringDepthParam->load());
-    smoothedOctaveBlend.setTargetValue(octaveBlendParam->load());
-    smoothedCharacter.setTargetValue(characterParam->load());
-    smoothedDrive.setTargetValue(driveParam->load());
-    smoothedVolume.setTargetValue(volumeParam->load());
-    smoothedStereoWidth.setTargetValue(stereoWidthParam->load());
-    smoothedNoiseAmount.setTargetValue(noiseAmountParam->load());
-
-    // Process each sample
-    for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
+    // Bypass: the dry path is always fed, so a fade has the aligned input from its first sample
+    dryDelay.write(buffer.getArrayOfReadPointers(), numProcessChannels, numSamples);
+    bypassMix.setTargetValue(bypassed ? 0.0f : 1.0f);
+
+    if (bypassed && !bypassMix.isSmoothing())
+    {
+        // Faded out: only the delayed input. Nothing else runs until bypass is released.
+        // Delayed by the output stage's latency now, not the reported one (which waits to settle)
+        bypassAsleep = true;
+        updateOutputStage(numSamples);
+        dryDelay.read(buffer.getArrayOfWritePointers(), numProcessChannels, numSamples, currentLatency);
+        return;
+    }
+
+    if (bypassAsleep)
+    {
+        // Resume from a clean state rather than integrators and flip-flops frozen
+        // mid-cycle; the fade-in covers the restart
+        restartProcessing();
+        outputLimiter.reset();
+        bypassAsleep = false;
+    }
+
+    // Rebuild the active modulation routings (modulated targets are set per control block)
+    if (modulationMatrix.updateRoutings(parameterValues))
+        updateSmoothingTimes();
+
+    // Update target values for parameter smoothing. Modulated parameters keep the
+    // target of the current control block, which may have started in an earlier host block
+    for (const auto& descriptor : parameterTable)
+        if (!modulationMatrix.isModulated(descriptor.paramID))
+            smoothed(descriptor.paramID).setTargetValue(getParameterValue(descriptor.paramID));
+
+    // Live or offline profile; switching re-prepares the chains and fades the output back in
+    const auto profile = selectProcessingProfile();
+
+    if (profile != activeProfile)
+    {
+        applyProcessingProfile(profile);
+        profileFade.setCurrentAndTargetValue(0.0f);
+        profileFade.setTargetValue(1.0f);
+    }
+
+    // Output stage mode and latency (settled changes are reported to the host)
+    const bool useTruePeakLimiter = updateOutputStage(numSamples);
+
+    // Metering tap: accumulates in locals, publishes once per block
+    auto tap = analysisTap.beginBlock();
+
+    const bool stereo = totalNumInputChannels > 1 && totalNumOutputChannels > 1;
+    const bool allowParallel = getParameterValue(ParamID::multiCore) >= 0.5f;
+    const bool linkedStereo = stereo && getParameterValue(ParamID::stereoLink) >= 0.5f;
+
+    juce::dsp::AudioBlock<float> block(buffer.getArrayOfWritePointers(),
+                                       static_cast<size_t>(numProcessChannels),
+                                       static_cast<size_t>(numSamples));
+
+    auto processingBlock = block;
+
+    if (activeOversampler != nullptr)
+    {
+        const StageTrace::Scope oversamplingTrace(StageTrace::Stage::OVERSAMPLING);
+        processingBlock = activeOversampler->processSamplesUp(block);
+    }
+
+    float* channels[maxChannels] = {};
+    for (size_t channel = 0; channel < processingBlock.getNumChannels(); ++channel)
+        channels[channel] = processingBlock.getChannelPointer(channel);
+
+    BlockContext context;
+    context.channels = channels;
+    context.numInputChannels = totalNumInputChannels;
+    context.numChannels = stereo ? 2 : 1;
+    context.numOutputChannels = static_cast<int>(processingBlock.getNumChannels());
+    context.numSamples = static_cast<int>(processingBlock.getNumSamples());
+    context.sidechain = &sidechain;
+    context.linkedStereo = linkedStereo;
+
+    processChunks(context, tap, allowParallel);
+
+    if (activeOversampler != nullptr)
+    {
+        const StageTrace::Scope oversamplingTrace(StageTrace::Stage::OVERSAMPLING);
+        activeOversampler->processSamplesDown(block);
+    }
+
+    // Fade in after a profile switch (the chains restarted from silence)
+    if (profileFade.isSmoothing())
+    {
+        for (int sample = 0; sample < numSamples; ++sample)
+        {
+            const float gain = profileFade.getNextValue();
+
+            for (int channel = 0; channel < numProcessChannels; ++channel)
+                buffer.setSample(channel, sample, buffer.getSample(channel, sample) * gain);
+        }
+    }
+
+    processCabinet(buffer, numProcessChannels, numSamples);
+
+    // Output stage: zero-latency soft knee or lookahead true-peak limiter
+    const int numOutputChannels = juce::jmin(totalNumOutputChannels, TruePeakLimiter::maxChannels);
+
+    {
+        // Limiter (or soft knee) plus output metering
+        const StageTrace::Scope limiterTrace(StageTrace::Stage::LIMITER);
+
+        if (useTruePeakLimiter)
+            outputLimiter.process(buffer.getArrayOfWritePointers(), numOutputChannels, numSamples);
+
+        const bool metered = tap.isActive();
+        const int numMeteredChannels = stereo ? 2 : 1;
+
+        // True-peak mode with no view attached: nothing left to do per sample
+        if (!useTruePeakLimiter || metered)
+        {
+            for (int sample = 0; sample < numSamples; ++sample)
+            {
+                float mono = 0.0f;
+
+                for (int channel = 0; channel < numOutputChannels; ++channel)
+                {
+                    float output = buffer.getSample(channel, sample);
+
+                    if (!useTruePeakLimiter)
+                    {
+                        output = softLimiter(output);
+                        buffer.setSample(channel, sample, output);
+                    }
+
+                    if (metered && channel < numMeteredChannels)
+                    {
+                        tap.addOutput(output);
+                        mono += output;
+                    }
+                }
+
+                if (metered)
+                    tap.addOutputSample(mono / static_cast<float>(numMeteredChannels));
+            }
+        }
+    }
+
+    analysisTap.commit(tap, numSamples);
+
+    // Bypass fade: equal-power crossfade between the output and the input delayed like it
+    if (bypassMix.isSmoothing())
+    {
+        auto* const* dry = dryBuffer.getArrayOfWritePointers();
+        dryDelay.read(dry, numProcessChannels, numSamples, currentLatency);
+
+        for (int sample = 0; sample < numSamples; ++sample)
+        {
+            const float angle = bypassMix.getNextValue() * juce::MathConstants<float>::halfPi;
+            const float wetGain = std::sin(angle);
+            const float dryGain = std::cos(angle);
+
+            for (int channel = 0; channel < numProcessChannels; ++channel)
+                buffer.setSample(channel, sample, buffer.getSample(channel, sample) * wetGain + dry[channel][sample] * dryGain);
+        }
+    }
+}
+
+void ReeseDestroyerAudioProcessor::processChunks(const BlockContext& context, AnalysisTap::BlockWriter& tap,
+                                                 bool allowParallel)
+{
+    // Path levels are only accumulated for an attached view
+    chunkSettings.metered = tap.isActive();
+
+    // Process in chunks: control pass, then the channel passes (serial or split across threads)
+    for (int chunkStart = 0; chunkStart < context.numSamples; chunkStart += chunkSize)
+    {
+        const int chunkLength = juce::jmin(chunkSize, context.numSamples - chunkStart);
+
+        runControlPass(context, chunkStart, chunkLength);
+
+        updateStereoSharing(context, chunkLength);
+
+        if (chunkSharing != StereoSharing::NONE)
+            runSharedPass(chunkLength);
+
+        float* outputs[maxChannels] = {};
+        for (int channel = 0; channel < context.numChannels; ++channel)
+            outputs[channel] = context.channels[channel] + chunkStart;
+
+        processChannels(outputs, context.numChannels, chunkLength, allowParallel);
+
+        if (chunkSettings.metered)
+        {
+            for (int channel = 0; channel < context.numChannels; ++channel)
+            {
+                auto& levels = channelChunks[static_cast<size_t>(channel)].levels;
+                tap.addLevels(levels);
+                levels = {};
+            }
+        }
+
+        // Duplicate mono to stereo
+        if (context.numChannels < context.numOutputChannels)
+            std::copy(outputs[0], outputs[0] + chunkLength, context.channels[1] + chunkStart);
+    }
+}
+
+void ReeseDestroyerAudioProcessor::runControlPass(const BlockContext& context, int chunkStart, int numSamples)
+{
+    const StageTrace::Scope controlTrace(StageTrace::Stage::CONTROL_PASS);
+
+    const int controlInterval = activeProfile.controlInterval;
+    auto& settings = chunkSettings;
+
+    const bool trackRingLfo = modulationMatrix.usesSource(ModulationMatrix::Source::RING_LFO);
+
+    settings.filterModel = getParameterValue(ParamID::filterModel) >= 0.5f ? ReeseChain::FilterModel::LADDER
+                                                                            : ReeseChain::FilterModel::SVF;
+
+    if (trackRingLfo && !ringLfoTracked)
+        ringLfoTracker = chains[0].main.getRingModulator();
+
+    ringLfoTracked = trackRingLfo;
+
+    for (int i = 0; i < numSamples; ++i)
     {
+        const int sample = chunkStart + i;
+        const auto index = static_cast<size_t>(i);
+
+        // Control rate: sidechain ducking and modulation matrix -> smoother targets.
+        // A control block carried over from the previous host block only feeds its detectors here
+        if (controlBlockPhase == 0)
+            updateControlBlock(context, sample, juce::jmin(controlInterval, context.numSamples - sample));
+        else if (sample == 0)
+            runDetectors(context, 0, juce::jmin(controlInterval - controlBlockPhase, context.numSamples));
+
+        if (++controlBlockPhase == controlInterval)
+            controlBlockPhase = 0;
+
         // Get smoothed parameter values for this sample
-        float cutoff = smoothedCutoff.getNextValue();
-        float resonance = smoothedResonance.getNextValue();
-        float ringRate = smoothedRingRate.getNextValue();
-        float ringDepth = smoothedRingDepth.getNextValue();
-        float octaveBlend = smoothedOctaveBlend.getNextValue();
-        float character = smoothedCharacter.getNextValue();
-        float drive = smoothedDrive.getNextValue();
-        float volumeDb = smoothedVolume.getNextValue();
-        float stereoWidth = smoothedStereoWidth.getNextValue();
-        float noiseAmount = smoothedNoiseAmount.getNextValue();
+        settings.cutoff[index] = smoothed(ParamID::cutoff).getNextValue() * ducking.cutoff.getNextValue();
+        settings.resonance[index] = smoothed(ParamID::resonance).getNextValue();
+        const float ringRate = smoothed(ParamID::ringRate).getNextValue();
+        settings.ringDepth[index] = smoothed(ParamID::ringDepth).getNextValue() * ducking.ringDepth.getNextValue();
+        settings.octaveBlend[index] = smoothed(ParamID::octaveBlend).getNextValue();
+        const float character = smoothed(ParamID::character).getNextValue();
+        settings.drive[index] = smoothed(ParamID::drive).getNextValue() * ducking.drive.getNextValue();
+        const float volumeDb = smoothed(ParamID::volume).getNextValue();
+        const float stereoWidth = smoothed(ParamID::stereoWidth).getNextValue();
+        settings.noiseAmount[index] = smoothed(ParamID::noiseAmount).getNextValue();
+        const float multiband = smoothed(ParamID::multiband).getNextValue();
+        const float crossoverLow = smoothed(ParamID::crossoverLow).getNextValue();
+        const float crossoverHigh = smoothed(ParamID::crossoverHigh).getNextValue();
+        settings.subCharacter[index] = smoothed(ParamID::subCharacter).getNextValue();
+        settings.highCharacter[index] = smoothed(ParamID::highCharacter).getNextValue();
+
+        // The chain advances its ring LFO twice per sample (ring and combined paths)
+        if (trackRingLfo)
+        {
+            ringLfoTracker.setFrequency(ringRate);
+            ringLfoTracker.processSample(0.0f);
+            ringLfoTracker.processSample(0.0f);
+        }
+
+        // Slight detune for stereo width
+        settings.ringRate[0][index] = ringRate;
+        settings.ringRate[1][index] = ringRate * (1.0f + stereoWidth * 0.05f);
 
         // Convert volume from dB to linear
-        float volumeLinear = juce::Decibels::decibelsToGain(volumeDb);
+        settings.volume[index] = decibelTable->lookup(volumeDb);
 
         // Calculate mix levels from character parameter
-        MixLevels mixLevels = calculateMixLevels(character);
-
-        // Update DSP module parameters
-        leftChannel.filter1.setCutoff(cutoff);
-        leftChannel.filter1.setResonance(resonance);
-        rightChannel.filter1.setCutoff(cutoff);
-        rightChannel.filter1.setResonance(resonance);
-
-        leftChannel.filter2.setCutoff(cutoff);
-        leftChannel.filter2.setResonance(resonance);
-        rightChannel.filter2.setCutoff(cutoff);
-        rightChannel.filter2.setResonance(resonance);
-
-        leftChannel.filter3.setCutoff(cutoff);
-        leftChannel.filter3.setResonance(resonance);
-        rightChannel.filter3.setCutoff(cutoff);
-        rightChannel.filter3.setResonance(resonance);
-
-        leftChannel.ringModulator.setFrequency(ringRate);
-        leftChannel.ringModulator.setDepth(ringDepth);
-        // Slight detune for stereo width
-        rightChannel.ringModulator.setFrequency(ringRate * (1.0f + stereoWidth * 0.05f));
-        rightChannel.ringModulator.setDepth(ringDepth);
+        settings.mixLevels[index] = ReeseChain::MixLevels::fromCharacter(character);
+        settings.multiband[index] = multiband;
 
-        leftChannel.waveShaper.setDrive(drive);
-        rightChannel.waveShaper.setDrive(drive);
+        const float leftInput = context.numInputChannels > 0 ? context.channels[0][sample] : 0.0f;
+        const float rightInput = context.numChannels > 1 ? context.channels[1][sample] : 0.0f;
 
-        leftChannel.noiseGen.setAmount(noiseAmount);
-        rightChannel.noiseGen.setAmount(noiseAmount);
+        // Full-band: the chain sees the input and the bands are silent.
+        // Multiband: the chain sees the mid band, sub/high are added back.
+        // While the toggle ramps, the chain input and the band sum crossfade.
+        auto& left = channelChunks[0];
+        auto& right = channelChunks[1];
 
-        // Process left channel
-        float leftInput = totalNumInputChannels > 0 ? buffer.getSample(0, sample) : 0.0f;
-        float leftClean = leftInput;
+        left.chainInput[index] = leftInput;
+        right.chainInput[index] = rightInput;
 
-        // Octave divider path
-        float leftOctaved = leftChannel.octaveDivider.processSample(leftInput);
-        leftOctaved = leftChannel.filter1.processSample(leftOctaved).lowPass;
+        const bool multibandActive = multiband > 0.0f;
 
-        // Ring mod path
-        float leftRinged = leftChannel.ringModulator.processSample(leftInput);
-        leftRinged = leftChannel.filter2.processSample(leftRinged).lowPass;
+        if (multibandActive)
+        {
+            if (!multibandWasActive)
+                crossover.reset();
 
-        // Combined path (ring mod + octave)
-        float leftCombined = leftChannel.ringModulator.processSample(leftOctaved);
-        leftCombined = leftChannel.filter3.processSample(leftCombined).lowPass;
+            crossover.setCrossoverFrequencies(crossoverLow, crossoverHigh);
+            const auto split = crossover.processSample(leftInput, rightInput);
 
-        // Mix all paths
-        float leftMixed = (leftClean * mixLevels.clean) +
-                         (leftOctaved * mixLevels.subOctave * octaveBlend) +
-                         (leftRinged * mixLevels.ringMod) +
-                         (leftCombined * mixLevels.ringModOctave);
+            left.chainInput[index] += multiband * (split.mid[0] - leftInput);
+            left.subBand[index] = split.sub[0];
+            left.highBand[index] = split.high[0];
 
-        // Apply saturation
-        leftMixed = leftChannel.waveShaper.process(leftMixed);
+            right.chainInput[index] += multiband * (split.mid[1] - rightInput);
+            right.subBand[index] = split.sub[1];
+            right.highBand[index] = split.high[1];
+        }
 
-        // Add noise
-        leftMixed = leftChannel.noiseGen.apply(leftMixed);
+        multibandWasActive = multibandActive;
+    }
+}
 
-        // Apply volume and soft limiting
-        leftMixed *= volumeLinear;
-        leftMixed = softLimiter(leftMixed);
+void ReeseDestroyerAudioProcessor::updateStereoSharing(const BlockContext& context, int numSamples)
+{
+    auto sharing = StereoSharing::NONE;
+
+    if (context.linkedStereo)
+    {
+        sharing = StereoSharing::LINKED;
+    }
+    else if (context.numChannels > 1)
+    {
+        const auto& left = channelChunks[0].chainInput;
+        const auto& right = channelChunks[1].chainInput;
 
-        buffer.setSample(0, sample, leftMixed);
+        // Sharing starts only once the right octave path is where the left one is (their
+        // flip-flops may have locked in opposite phase while the input was stereo)
+        sharing = chunkSharing == StereoSharing::DUAL_MONO
+               || chains[1].main.hasOctaveStateOf(chains[0].main, dualMonoTolerance)
+                ? StereoSharing::DUAL_MONO
+                : StereoSharing::NONE;
 
-        // Process right channel (if stereo)
-        if (totalNumInputChannels > 1 && totalNumOutputChannels > 1)
+        for (int i = 0; i < numSamples && sharing == StereoSharing::DUAL_MONO; ++i)
         {
-            float rightInput = buffer.getSample(1, sample);
-            float rightClean = rightInput;
+            if (std::abs(left[static_cast<size_t>(i)] - right[static_cast<size_t>(i)]) > dualMonoTolerance)
+                sharing = StereoSharing::NONE;
+        }
+    }
+
+    if (sharing == chunkSharing)
+        return;
+
+    // The right chains skipped the shared stages: continue from the left chains' state
+    auto& left = chains[0];
+    auto& right = chains[1];
+
+    if (chunkSharing == StereoSharing::LINKED)
+    {
+        right.main.copyPathState(left.main);
+        right.sub.copyPathState(left.sub);
+        right.high.copyPathState(left.high);
+    }
+    else if (chunkSharing == StereoSharing::DUAL_MONO && sharing == StereoSharing::NONE)
+    {
+        right.main.copyOctaveState(left.main);
+    }
 
-            float rightOctaved = rightChannel.octaveDivider.processSample(rightInput);
-            rightOctaved = rightChannel.filter1.processSample(rightOctaved).lowPass;
+    chunkSharing = sharing;
+}
 
-            float rightRinged = rightChannel.ringModulator.processSample(rightInput);
-            rightRinged = rightChannel.filter2.processSample(rightRinged).lowPass;
+void ReeseDestroyerAudioProcessor::runSharedPass(int numSamples)
+{
+    const StageTrace::Scope sharedTrace(StageTrace::Stage::SHARED_PASS);
 
-            float rightCombined = rightChannel.ringModulator.processSample(rightOctaved);
-            rightCombined = rightChannel.filter3.processSample(rightCombined).lowPass;
+    const auto& settings = chunkSettings;
+    auto& leftChains = chains[0];
+    const auto& left = channelChunks[0];
+    const auto& right = channelChunks[1];
 
-            float rightMixed = (rightClean * mixLevels.clean) +
-                              (rightOctaved * mixLevels.subOctave * octaveBlend) +
-                              (rightRinged * mixLevels.ringMod) +
-                              (rightCombined * mixLevels.ringModOctave);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto index = static_cast<size_t>(i);
 
-            rightMixed = rightChannel.waveShaper.process(rightMixed);
-            rightMixed = rightChannel.noiseGen.apply(rightMixed);
-            rightMixed *= volumeLinear;
-            rightMixed = softLimiter(rightMixed);
+        updateChain(leftChains.main, settings, 0, i);
 
-            buffer.setSample(1, sample, rightMixed);
-        }
-        else if (totalNumOutputChannels > 1)
+        if (chunkSharing == StereoSharing::DUAL_MONO)
         {
-            // Duplicate mono to stereo
-            buffer.setSample(1, sample, leftMixed);
+            sharedChunk.octave[index] = leftChains.main.processOctave(left.chainInput[index]);
+            continue;
         }
+
+        // Linked Stereo: the mid signal, and the band chains once on the mid bands
+        sharedChunk.paths[index] = leftChains.main.processShared(0.5f * (left.chainInput[index] + right.chainInput[index]));
+
+        sharedChunk.bands[index] = settings.multiband[index] > 0.0f
+                                 ? processBands(leftChains, settings, 0, i,
+                                                0.5f * (left.subBand[index] + right.subBand[index]),
+                                                0.5f * (left.highBand[index] + right.highBand[index]))
+                                 : 0.0f;
+    }
+}
+
+void ReeseDestroyerAudioProcessor::runChannelPass(int channel, float* output, int numSamples)
+{
+    // Per-sample stage laps below are emitted as children of this slice
+    const StageTrace::Scope channelTrace(StageTrace::Stage::CHANNEL_PASS);
+
+    const auto& settings = chunkSettings;
+    const auto sharing = chunkSharing;
+    auto& channelChains = chains[static_cast<size_t>(channel)];
+    auto& channelChunk = channelChunks[static_cast<size_t>(channel)];
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto index = static_cast<size_t>(i);
+        const auto& mixLevels = settings.mixLevels[index];
+        const float octaveBlend = settings.octaveBlend[index];
+
+        updateChain(channelChains.main, settings, channel, i);
+
+        float bands = 0.0f;
+
+        if (sharing == StereoSharing::LINKED)
+            bands = sharedChunk.bands[index];
+        else if (settings.multiband[index] > 0.0f)
+            bands = processBands(channelChains, settings, channel, i, channelChunk.subBand[index], channelChunk.highBand[index]);
+
+        // Process the chain (or its per-channel stages), then apply volume to the band sum
+        const float input = channelChunk.chainInput[index];
+        ReeseChain::Sample result;
+
+        if (sharing == StereoSharing::LINKED)
+            result = channelChains.main.processLinked(sharedChunk.paths[index], mixLevels, octaveBlend);
+        else if (sharing == StereoSharing::DUAL_MONO)
+            result = channelChains.main.processSample(input, sharedChunk.octave[index], mixLevels, octaveBlend);
+        else
+            result = channelChains.main.processSample(input, mixLevels, octaveBlend);
+
+        output[i] = (result.output + bands) * settings.volume[index];
+
+        if (settings.metered)
+            channelChunk.levels.addPaths(result.clean, result.octave, result.ring, result.combined);
     }
 }
 
+float ReeseDestroyerAudioProcessor::processBands(ChannelChains& channelChains, const ChunkSettings& settings, int channel,
+                                                 int index, float subBand, float highBand)
+{
+    const auto sampleIndex = static_cast<size_t>(index);
+    const auto& mixLevels = settings.mixLevels[sampleIndex];
+    const float octaveBlend = settings.octaveBlend[sampleIndex];
+    const float subCharacter = settings.subCharacter[sampleIndex];
+    const float highCharacter = settings.highCharacter[sampleIndex];
+
+    if (subCharacter > 0.0f)
+        updateChain(channelChains.sub, settings, channel, index);
+
+    if (highCharacter > 0.0f)
+        updateChain(channelChains.high, settings, channel, index);
+
+    return settings.multiband[sampleIndex] * (channelChains.sub.processBand(subBand, subCharacter, mixLevels, octaveBlend)
+                                            + channelChains.high.processBand(highBand, highCharacter, mixLevels, octaveBlend));
+}
+
 //==============================================================================
-ReeseDestroyerAudioProcessor::MixLevels ReeseDestroyerAudioProcessor::calculateMixLevels(float characterPercent)
+void ReeseDestroyerAudioProcessor::processChannels(float* const* outputs, int numChannels, int numSamples,
+                                                   bool allowParallel)
 {
-    // Character: 0% = clean bass, 100% = maximum chaos
-    MixLevels levels;
+    // Not worth a handoff for one channel or a few samples (see the parallel benchmark)
+    if (!allowParallel || numChannels < 2 || numSamples < minimumParallelSamples || !channelWorker.isReady())
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            runChannelPass(channel, outputs[channel], numSamples);
+
+        return;
+    }
+
+    // Second half of the channels on the worker, first half here
+    const int split = numChannels / 2;
+    ChannelTask task { this, outputs, split, numChannels - split, numSamples };
+
+    channelWorker.dispatch(runChannelTask, &task);
+
+    for (int channel = 0; channel < split; ++channel)
+        runChannelPass(channel, outputs[channel], numSamples);
+
+    channelWorker.join();
+}
+
+void ReeseDestroyerAudioProcessor::runChannelTask(void* context)
+{
+    const auto& task = *static_cast<const ChannelTask*>(context);
+
+    for (int channel = task.firstChannel; channel < task.firstChannel + task.numChannels; ++channel)
+        task.processor->runChannelPass(channel, task.outputs[channel], task.numSamples);
+}
+
+void ReeseDestroyerAudioProcessor::updateControlBlock(const BlockContext& context, int startSample, int numSamples)
+{
+    // Control-rate parameters advance their smoothers a whole block at a time
+    // (the full interval: the rest of a block cut off by the host block follows in the next one)
+    const int controlInterval = activeProfile.controlInterval;
+
+    sidechainFollower.setAttack(smoothed(ParamID::sidechainAttack).skip(controlInterval));
+    sidechainFollower.setRelease(smoothed(ParamID::sidechainRelease).skip(controlInterval));
+    sidechainFollower.setMode(getParameterValue(ParamID::sidechainRms) >= 0.5f
+                                  ? EnvelopeFollower::DetectorMode::RMS
+                                  : EnvelopeFollower::DetectorMode::PEAK);
+
+    const float duckCutoff = smoothed(ParamID::duckCutoff).skip(controlInterval);
+    const float duckRingDepth = smoothed(ParamID::duckRingDepth).skip(controlInterval);
+    const float duckDrive = smoothed(ParamID::duckDrive).skip(controlInterval);
+
+    const auto levels = runDetectors(context, startSample, numSamples);
+    const float envelope = levels.sidechain;
 
-    levels.clean = 0.5f - (characterPercent * 0.3f);           // Decreases slightly
-    levels.subOctave = 0.2f + (characterPercent * 0.4f);       // Increases
-    levels.ringMod = characterPercent * 0.6f;                  // Increases strongly
-    levels.ringModOctave = characterPercent * characterPercent * 0.4f; // Quadratic increase
+    // Cutoff ducks by up to 3 octaves, ring depth and drive down to zero
+    ducking.cutoff.setTargetValue(std::exp2(-3.0f * duckCutoff * envelope));
+    ducking.ringDepth.setTargetValue(1.0f - duckRingDepth * envelope);
+    ducking.drive.setTargetValue(1.0f - duckDrive * envelope);
+
+    // Modulation matrix: only active routings, only sources they read
+    modulationMatrix.advanceLfos(controlInterval,
+                                 smoothed(ParamID::lfo1Rate).skip(controlInterval),
+                                 smoothed(ParamID::lfo2Rate).skip(controlInterval));
+
+    using Source = ModulationMatrix::Source;
+    ModulationMatrix::SourceValues sources {};
+
+    if (modulationMatrix.usesSource(Source::RING_LFO))
+        sources[static_cast<size_t>(Source::RING_LFO)] = ringLfoTracker.getLfoValue();
+
+    if (modulationMatrix.usesSource(Source::LFO1))
+        sources[static_cast<size_t>(Source::LFO1)] = modulationMatrix.getLfo1();
+
+    if (modulationMatrix.usesSource(Source::LFO2))
+        sources[static_cast<size_t>(Source::LFO2)] = modulationMatrix.getLfo2();
+
+    sources[static_cast<size_t>(Source::INPUT_ENVELOPE)] = levels.input;
+    sources[static_cast<size_t>(Source::SIDECHAIN_ENVELOPE)] = envelope;
+
+    const auto& modulation = modulationMatrix.evaluate(sources);
+
+    // Offsets are normalized: log parameters move in octaves, all stay in range
+    for (int i = 0; i < modulation.numDestinations; ++i)
+    {
+        const auto id = modulation.destinations[static_cast<size_t>(i)];
+        const auto* parameter = parameterObjects[toIndex(id)];
+
+        const float normalized = parameter->convertTo0to1(getParameterValue(id))
+                               + modulation.offsets[static_cast<size_t>(i)];
+
+        smoothed(id).setTargetValue(parameter->convertFrom0to1(juce::jlimit(0.0f, 1.0f, normalized)));
+    }
+}
+
+ReeseDestroyerAudioProcessor::DetectorLevels ReeseDestroyerAudioProcessor::runDetectors(const BlockContext& context,
+                                                                                        int startSample, int numSamples)
+{
+    DetectorLevels levels;
+
+    // The sidechain stays at the host rate: read the host samples these control-block samples cover
+    // (none for some blocks when oversampling with a short interval; the envelope then holds).
+    // No sidechain connected: zero channels, the envelope releases to 0
+    const int order = activeProfile.oversamplingOrder;
+    const int sidechainStart = startSample >> order;
+    const int sidechainEnd = (startSample + numSamples) >> order;
+
+    levels.sidechain = juce::jmin(1.0f, sidechainFollower.process(context.sidechain->getArrayOfReadPointers(),
+                                                                  context.sidechain->getNumChannels(),
+                                                                  sidechainStart, sidechainEnd - sidechainStart));
+
+    if (modulationMatrix.usesSource(ModulationMatrix::Source::INPUT_ENVELOPE))
+        levels.input = juce::jmin(1.0f,
+            inputFollower.process(context.channels, juce::jmin(context.numInputChannels, context.numChannels),
+                                  startSample, numSamples));
 
     return levels;
 }
 
+void ReeseDestroyerAudioProcessor::updateSmoothingTimes()
+{
+    const int rampSteps = juce::roundToInt(processingRate * smoothingTime);
+
+    for (const auto& descriptor : parameterTable)
+    {
+        auto& smoother = smoothed(descriptor.paramID);
+        const float current = smoother.getCurrentValue();
+        const float target = smoother.getTargetValue();
+
+        // reset() jumps to the target, so restore the ramp in progress afterwards
+        smoother.reset(modulationMatrix.isModulated(descriptor.paramID) ? activeProfile.controlInterval : rampSteps);
+        smoother.setCurrentAndTargetValue(current);
+        smoother.setTargetValue(target);
+    }
+}
+
+void ReeseDestroyerAudioProcessor::updateChain(ReeseChain& chain, const ChunkSettings& settings, int channel, int index)
+{
+    const auto i = static_cast<size_t>(index);
+
+    chain.setSettings({ settings.cutoff[i],
+                        settings.resonance[i],
+                        settings.ringRate[static_cast<size_t>(channel)][i],
+                        settings.ringDepth[i],
+                        settings.drive[i],
+                        settings.noiseAmount[i],
+                        settings.filterModel });
+}
+
+//==============================================================================
+void ReeseDestroyerAudioProcessor::processCabinet(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples)
+{
+    auto* cabinet = cabinetLoader.getCabinet();
+
+    // A cabinet is only used at the rate it was built for (prepare() rebuilds it)
+    const bool available = cabinet != nullptr && cabinet->impulse != nullptr
+                        && cabinet->impulse->getSampleRate() == getSampleRate();
+
+    const bool enabled = available && getParameterValue(ParamID::cabinet) >= 0.5f;
+    cabinetMix.setTargetValue(enabled ? getParameterValue(ParamID::cabinetMix) : 0.0f);
+
+    if (!available)
+    {
+        cabinetMix.setCurrentAndTargetValue(0.0f);
+        cabinetRunning = false;
+        return;
+    }
+
+    if (!cabinetMix.isSmoothing() && cabinetMix.getTargetValue() <= 0.0f)
+    {
+        cabinetRunning = false;
+        return;
+    }
+
+    const StageTrace::Scope cabinetTrace(StageTrace::Stage::CABINET);
+
+    if (!cabinetRunning)
+    {
+        for (auto& convolver : cabinet->convolvers)
+            convolver.reset();
+
+        cabinetRunning = true;
+    }
+
+    numChannels = juce::jmin(numChannels, CabinetLoader::maxChannels);
+    const bool fullyWet = !cabinetMix.isSmoothing() && cabinetMix.getTargetValue() >= 1.0f;
+
+    if (fullyWet)
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            cabinet->convolvers[static_cast<size_t>(channel)].process(buffer.getWritePointer(channel), numSamples);
+
+        return;
+    }
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        cabinetDry.copyFrom(channel, 0, buffer, channel, 0, numSamples);
+        cabinet->convolvers[static_cast<size_t>(channel)].process(buffer.getWritePointer(channel), numSamples);
+    }
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        const float mix = cabinetMix.getNextValue();
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const float dry = cabinetDry.getSample(channel, sample);
+            buffer.setSample(channel, sample, dry + mix * (buffer.getSample(channel, sample) - dry));
+        }
+    }
+}
+
+//==============================================================================
 float ReeseDestroyerAudioProcessor::softLimiter(float input)
 {
     // Prevent harsh clipping at output
@@ -499,27 +1134,159 @@ bool ReeseDestroyerAudioProcessor::hasEditor() const
 
 juce::AudioProcessorEditor* ReeseDestroyerAudioProcessor::createEditor()
 {
-    // For now, use generic editor - custom GUI will be implemented later
-    return new juce::GenericAudioProcessorEditor(*this);
+    return new ReeseDestroyerAudioProcessorEditor(*this);
+}
+
+//==============================================================================
+ParameterValues ReeseDestroyerAudioProcessor::captureParameterValues() const
+{
+    ParameterValues values;
+
+    for (const auto& descriptor : parameterTable)
+        values[descriptor.paramID] = getParameterValue(descriptor.paramID);
+
+    return values;
+}
+
+void ReeseDestroyerAudioProcessor::applyParameterValues(const ParameterValues& values)
+{
+    for (const auto& descriptor : parameterTable)
+    {
+        auto* parameter = parameterObjects[toIndex(descriptor.paramID)];
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(values[descriptor.paramID]));
+    }
+}
+
+//==============================================================================
+void ReeseDestroyerAudioProcessor::applyPresetAtNextBlock(const ParameterValues& values)
+{
+    {
+        const juce::SpinLock::ScopedLockType lock(presetLock);
+        stagedPreset = values;
+        presetSwap = PresetSwap::PENDING;
+    }
+
+    presetStagedTime = juce::Time::getMillisecondCounter();
+    startTimer(presetPollInterval);
+}
+
+void ReeseDestroyerAudioProcessor::swapInStagedPreset() noexcept
+{
+    if (presetSwap.load(std::memory_order_acquire) != PresetSwap::PENDING)
+        return;
+
+    // Being restaged on the message thread: the next block takes it
+    const juce::SpinLock::ScopedTryLockType lock(presetLock);
+
+    if (!lock.isLocked() || presetSwap.load() != PresetSwap::PENDING)
+        return;
+
+    for (const auto& descriptor : parameterTable)
+        if (ParameterTable::isPresetParameter(descriptor))
+            parameterValues[toIndex(descriptor.paramID)]->store(stagedPreset[descriptor.paramID]);
+
+    presetSwap = PresetSwap::SWAPPED;
+}
+
+void ReeseDestroyerAudioProcessor::timerCallback()
+{
+    ParameterValues values;
+
+    {
+        const juce::SpinLock::ScopedLockType lock(presetLock);
+        const auto state = presetSwap.load();
+
+        // Still waiting for a block, unless none came in time (host stopped, or not prepared)
+        if (state == PresetSwap::PENDING && juce::Time::getMillisecondCounter() - presetStagedTime < presetSwapTimeout)
+            return;
+
+        stopTimer();
+
+        if (state == PresetSwap::NONE)
+            return;
+
+        values = stagedPreset;
+        presetSwap = PresetSwap::NONE;
+    }
+
+    // Rows outside presets (bypass and the engine options) keep what the host set
+    const auto current = captureParameterValues();
+
+    for (const auto& descriptor : parameterTable)
+        if (!ParameterTable::isPresetParameter(descriptor))
+            values[descriptor.paramID] = current[descriptor.paramID];
+
+    // Swapped, the atomics already hold these values: the parameter objects and host catch up
+    parameterHistory.recordChanges(values);
+    applyParameterValues(values);
+}
+
+void ReeseDestroyerAudioProcessor::cancelStagedPreset()
+{
+    // Under the lock: a swap in progress on the audio thread finishes first
+    const juce::SpinLock::ScopedLockType lock(presetLock);
+    presetSwap = PresetSwap::NONE;
 }
 
 //==============================================================================
 void ReeseDestroyerAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    // Save parameter state
-    auto state = parameters.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    // Save parameter state as a compact fixed-layout binary block, plus the cabinet IR path
+    const auto cabinetPath = cabinetLoader.getFile().getFullPathName().toStdString();
+
+    if (cabinetPath.empty())
+        StateSerializer::write(captureParameterValues(), destData);
+    else
+        StateSerializer::write(captureParameterValues(), destData,
+                               { { cabinetChunkTag, cabinetPath.data(), cabinetPath.size() } });
 }
 
 void ReeseDestroyerAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
-    // Restore parameter state
+    // Binary state: direct copy into the parameters, no parsing
+    if (StateSerializer::isBinaryState(data, static_cast<size_t>(sizeInBytes)))
+    {
+        // Parameters the blob predates take their table defaults, whatever this instance held
+        ParameterValues values;
+        juce::File cabinetFile;
+
+        const auto readChunk = [&](juce::uint32 tag, const void* chunkData, size_t size) {
+            const auto path = juce::String::fromUTF8(static_cast<const char*>(chunkData), static_cast<int>(size));
+
+            if (tag == cabinetChunkTag && juce::File::isAbsolutePath(path))
+                cabinetFile = juce::File(path);
+        };
+
+        if (StateSerializer::read(data, static_cast<size_t>(sizeInBytes), values, readChunk))
+        {
+            cancelStagedPreset();
+            applyParameterValues(values);
+            parameterHistory.clear();
+
+            // States without the chunk have no cabinet (loads in the background)
+            if (cabinetFile == juce::File())
+                cabinetLoader.clear();
+            else
+                cabinetLoader.load(cabinetFile);
+        }
+
+        return;
+    }
+
+    // Legacy state (v1.0 sessions): APVTS ValueTree stored as XML
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
     if (xmlState.get() != nullptr)
+    {
         if (xmlState->hasTagName(parameters.state.getType()))
+        {
+            // Parameters missing from the tree (newer than v1.0) get their defaults
+            cancelStagedPreset();
             parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+            parameterHistory.clear();
+            cabinetLoader.clear();
+        }
+    }
 }
 
 //==============================================================================
@@ -2,11 +2,21 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
-#include "DSP/OctaveDivider.h"
-#include "DSP/RingModulator.h"
-#include "DSP/StateVariableFilter.h"
-#include "DSP/WaveShapers.h"
-#include "DSP/NoiseGenerator.h"
+#include "DSP/ReeseChain.h"
+#include "DSP/SharedTables.h"
+#include "DSP/LinkwitzRileyCrossover.h"
+#include "DSP/EnvelopeFollower.h"
+#include "DSP/TruePeakLimiter.h"
+#include "DSP/LatencyDelay.h"
+#include "Parameters/ParameterTable.h"
+#include "Parameters/StateSerializer.h"
+#include "Parameters/PresetService.h"
+#include "Parameters/ParameterHistory.h"
+#include "Modulation/ModulationMatrix.h"
+#include "Analysis/AnalysisTap.h"
+#include "Analysis/FilterResponse.h"
+#include "Cabinet/CabinetLoader.h"
+#include "Threading/RealtimeWorker.h"
 
 //==============================================================================
 /**
@@ -18,8 +28,20 @@
  * - Resonant state-variable filtering
  * - Analog-style saturation and wave shaping
  * - Subtle noise for analog character
+ * - Optional sidechain input for kick-ducked basslines
+ * - Optional cabinet impulse response (zero-latency partitioned convolution)
+ * - Control-rate modulation matrix (LFOs and envelopes to any parameter)
+ *
+ * Each block is processed in fixed 64-sample chunks of two passes: a serial control pass
+ * (smoothers, control-rate modulation, crossover) that writes per-sample
+ * settings, then a channel pass that runs each channel's chains from those
+ * settings only. Channels share no state in the channel pass, so with
+ * Multi-Core on the right channel runs on a worker thread.
  */
-class ReeseDestroyerAudioProcessor : public juce::AudioProcessor
+class ReeseDestroyerAudioProcessor : public juce::AudioProcessor,
+                                     private juce::AudioProcessorValueTreeState::Listener,
+                                     private juce::AsyncUpdater,
+                                     private juce::Timer
 {
 public:
     //==============================================================================
@@ -35,6 +57,10 @@ public:
     #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    // The Bypass parameter, so hosts drive it instead of cutting the output
+    juce::AudioProcessorParameter* getBypassParameter() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -63,68 +89,365 @@ public:
     // Parameter access
     juce::AudioProcessorValueTreeState& getParameters() { return parameters; }
 
+    // Metering/spectrum tap read by the editor
+    AnalysisTap& getAnalysisTap() { return analysisTap; }
+
+    // Cached filter response curves for the editor
+    FilterResponse& getFilterResponse() { return filterResponse; }
+
+    // Cabinet IR file (the editor loads files; the Cabinet parameters switch the stage)
+    CabinetLoader& getCabinetLoader() { return cabinetLoader; }
+
+    // Preset files, read and written in the background (the editor loads and saves them)
+    PresetService& getPresetService() { return presetService; }
+
+    // Undo/redo of parameter edits and preset loads
+    ParameterHistory& getParameterHistory() { return parameterHistory; }
+
+    // All preset values (real units, constrained) take effect together at the start of
+    // the next block, then the host is told; bypass and the engine rows are left alone.
+    // Message thread
+    void applyPresetAtNextBlock(const ParameterValues& values);
+
 private:
     //==============================================================================
     // Parameter layout creation
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
     //==============================================================================
-    // Parameters (8 main controls)
+    // Parameters (generated from parameterTable, indexed by ParamID)
     juce::AudioProcessorValueTreeState parameters;
 
-    std::atomic<float>* cutoffParam = nullptr;
-    std::atomic<float>* resonanceParam = nullptr;
-    std::atomic<float>* ringRateParam = nullptr;
-    std::atomic<float>* ringDepthParam = nullptr;
-    std::atomic<float>* octaveBlendParam = nullptr;
-    std::atomic<float>* characterParam = nullptr;
-    std::atomic<float>* driveParam = nullptr;
-    std::atomic<float>* volumeParam = nullptr;
+    std::array<std::atomic<float>*, numParameters> parameterValues {};
+    std::array<juce::RangedAudioParameter*, numParameters> parameterObjects {};
+
+    // Edits as compact deltas (the APVTS has no UndoManager, see ParameterHistory.h)
+    ParameterHistory parameterHistory { parameters };
+
+    float getParameterValue(ParamID id) const { return parameterValues[toIndex(id)]->load(); }
+
+    // Snapshot / restore all parameters in real units (state + presets)
+    ParameterValues captureParameterValues() const;
+    void applyParameterValues(const ParameterValues& values);
+
+    //==============================================================================
+    // Preset swap: applyPresetAtNextBlock() stages the values and the audio thread
+    // writes them all to the parameter atomics before its next block, so no block
+    // runs on half a preset. The timer then sets the parameter objects to match for
+    // the host (and directly, if no block comes within presetSwapTimeout)
+    static constexpr int presetPollInterval = 10;             // ms
+    static constexpr juce::uint32 presetSwapTimeout = 100;    // ms
+
+    enum class PresetSwap
+    {
+        NONE,
+        PENDING,    // Staged, waiting for the audio thread
+        SWAPPED     // In the atomics, waiting for the host update
+    };
+
+    PresetService presetService;
+    juce::SpinLock presetLock;                   // The audio thread only ever tries it
+    ParameterValues stagedPreset;                // Guarded by presetLock
+    std::atomic<PresetSwap> presetSwap { PresetSwap::NONE };
+    juce::uint32 presetStagedTime = 0;           // Message thread
+
+    void swapInStagedPreset() noexcept;          // Audio thread, before a block
+    void timerCallback() override;
+
+    // A state restore supersedes a preset still being swapped in
+    void cancelStagedPreset();
+
+    //==============================================================================
+    // DSP chains (per-channel for stereo processing, see DSP/ReeseChain.h)
+    static constexpr int maxChannels = 2;
+
+    // Per-channel chains. Multiband: the main chain runs the mid band, the sub
+    // and high bands have their own chains that only run while their Character > 0
+    struct ChannelChains
+    {
+        ReeseChain main;
+        ReeseChain sub;
+        ReeseChain high;
+    };
+
+    std::array<ChannelChains, maxChannels> chains;
+
+    // Noise/chaos seeds come from the OS at the first prepareToPlay, not in the
+    // constructor: hosts construct every instance of a project before any audio
+    bool chainsSeeded = false;
 
-    // Additional internal parameters
-    std::atomic<float>* stereoWidthParam = nullptr;
-    std::atomic<float>* noiseAmountParam = nullptr;
+    void seedChains();
+
+    LinkwitzRileyCrossover crossover;
+    bool multibandWasActive = false;
 
     //==============================================================================
-    // DSP Modules (per-channel for stereo processing)
-    struct ChannelDSP
+    // Parameter smoothing to prevent zipper noise (one smoother per parameter)
+    static constexpr double smoothingTime = 0.05;   // 50ms ramp
+
+    std::array<juce::SmoothedValue<float>, numParameters> smoothedValues;
+
+    juce::SmoothedValue<float>& smoothed(ParamID id) { return smoothedValues[toIndex(id)]; }
+
+    // Modulated parameters ramp over one control block, the rest over smoothingTime
+    void updateSmoothingTimes();
+
+    //==============================================================================
+    // Sidechain ducking and modulation, evaluated once per control block (not per sample)
+    static constexpr int controlBlockSize = 32;   // Live; the offline profile uses 1
+
+    EnvelopeFollower sidechainFollower;
+    EnvelopeFollower inputFollower;      // Only runs while a routing uses it
+    ModulationMatrix modulationMatrix;
+
+    // Gain factors applied to cutoff, ring depth and drive, ramped across each control block
+    struct Ducking
     {
-        OctaveDivider octaveDivider;
-        RingModulator ringModulator;
-        StateVariableFilter filter1;  // For octave path
-        StateVariableFilter filter2;  // For ring mod path
-        StateVariableFilter filter3;  // For combined path
-        WaveShapers waveShaper;
-        NoiseGenerator noiseGen;
+        juce::SmoothedValue<float> cutoff;
+        juce::SmoothedValue<float> ringDepth;
+        juce::SmoothedValue<float> drive;
     };
 
-    ChannelDSP leftChannel;
-    ChannelDSP rightChannel;
+    Ducking ducking;
 
     //==============================================================================
-    // Parameter smoothing to prevent zipper noise
-    juce::SmoothedValue<float> smoothedCutoff;
-    juce::SmoothedValue<float> smoothedResonance;
-    juce::SmoothedValue<float> smoothedRingRate;
-    juce::SmoothedValue<float> smoothedRingDepth;
-    juce::SmoothedValue<float> smoothedOctaveBlend;
-    juce::SmoothedValue<float> smoothedCharacter;
-    juce::SmoothedValue<float> smoothedDrive;
-    juce::SmoothedValue<float> smoothedVolume;
-    juce::SmoothedValue<float> smoothedStereoWidth;
-    juce::SmoothedValue<float> smoothedNoiseAmount;
+    // Processing profile: live, or the Offline Quality while the host renders (isNonRealtime)
+    static constexpr int maxOversamplingOrder = 3;   // 8x
+    static constexpr double profileFadeTime = 0.01;  // Fade-in after a switch
+
+    struct ProcessingProfile
+    {
+        int oversamplingOrder;   // log2 of the oversampling factor (0 = host rate)
+        int controlInterval;     // Samples per control block at the processing rate
+
+        bool operator==(const ProcessingProfile&) const = default;
+    };
+
+    static constexpr ProcessingProfile liveProfile { 0, controlBlockSize };
+
+    ProcessingProfile activeProfile = liveProfile;
+    double processingRate = 44100.0;   // Host rate times the oversampling factor
+    int preparedBlockSize = 0;
+
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, maxOversamplingOrder> oversamplers;
+    int oversamplerChannels = 0;     // Layout the oversamplers were built for (hosts
+    int oversamplerBlockSize = 0;    // re-prepare with the same one several times)
+    juce::dsp::Oversampling<float>* activeOversampler = nullptr;
+    int oversamplingLatency = 0;
+
+    juce::SmoothedValue<float> profileFade;
+
+    ProcessingProfile selectProcessingProfile() const;
+
+    // Re-prepare everything that runs at the processing rate (allocation-free)
+    void applyProcessingProfile(const ProcessingProfile& profile);
 
     //==============================================================================
-    // Mixing levels calculated from Character parameter
-    struct MixLevels
+    // One (possibly oversampled) host block as seen by the control and channel passes
+    struct BlockContext
     {
-        float clean;
-        float subOctave;
-        float ringMod;
-        float ringModOctave;
+        float* const* channels = nullptr;   // Processing-rate audio, processed in place
+        int numInputChannels = 0;
+        int numChannels = 1;                // Channels with their own chains
+        int numOutputChannels = 1;
+        int numSamples = 0;                 // At the processing rate
+        const juce::AudioBuffer<float>* sidechain = nullptr;   // Host rate
+        bool linkedStereo = false;          // Linked Stereo (stereo layouts only)
     };
 
-    MixLevels calculateMixLevels(float characterPercent);
+    // The control-block grid runs on across host blocks, so short host blocks
+    // continue the current control block instead of starting one per call
+    int controlBlockPhase = 0;   // Samples into the current control block
+
+    // Starts a control block; numSamples is the part of it inside this context
+    void updateControlBlock(const BlockContext& context, int startSample, int numSamples);
+
+    // Envelope detectors over samples of the current control block (they read audio,
+    // so a control block split across host blocks is followed in both)
+    struct DetectorLevels
+    {
+        float sidechain = 0.0f;
+        float input = 0.0f;
+    };
+
+    DetectorLevels runDetectors(const BlockContext& context, int startSample, int numSamples);
+
+    //==============================================================================
+    // Chunked processing: serial control pass, then one channel pass per channel.
+    // Host blocks of any size are split into fixed chunks (the last one shorter),
+    // so the per-chunk arrays stay in L1 (about 6KB) however long the host block
+    static constexpr int chunkSize = 64;
+
+    template <typename Value>
+    using ChunkArray = std::array<Value, chunkSize>;
+
+    // Per-sample settings of one chunk, shared read-only by every channel.
+    // Cache-line aligned, so each array starts on a vector boundary
+    struct alignas(64) ChunkSettings
+    {
+        ChunkArray<float> cutoff {};
+        ChunkArray<float> resonance {};
+        std::array<ChunkArray<float>, maxChannels> ringRate {};   // Right channel detuned by stereo width
+        ChunkArray<float> ringDepth {};
+        ChunkArray<float> drive {};
+        ChunkArray<float> noiseAmount {};
+        ChunkArray<float> octaveBlend {};
+        ChunkArray<ReeseChain::MixLevels> mixLevels {};
+        ChunkArray<float> volume {};        // Linear gain
+        ChunkArray<float> multiband {};
+        ChunkArray<float> subCharacter {};
+        ChunkArray<float> highCharacter {};
+        ReeseChain::FilterModel filterModel = ReeseChain::FilterModel::SVF;   // Per chunk
+        bool metered = false;               // Per block: an analysis view is attached
+    };
+
+    // Per-channel inputs of one chunk, and the levels its channel pass metered
+    struct alignas(64) ChannelChunk
+    {
+        ChunkArray<float> chainInput {};   // Full band, mid band or a crossfade between them
+        ChunkArray<float> subBand {};
+        ChunkArray<float> highBand {};
+        AnalysisTap::PathLevels levels;
+    };
+
+    ChunkSettings chunkSettings;
+
+    // Volume dB -> gain per sample (process-wide table, acquired at the first prepareToPlay)
+    SharedTables::Handle decibelTable;
+    std::array<ChannelChunk, maxChannels> channelChunks;
+
+    //==============================================================================
+    // Stereo sharing: chain stages computed once for both channels in a shared
+    // pass (audio thread, between the control pass and the channel passes).
+    //  - Dual mono: chain inputs equal within dualMonoTolerance over the chunk.
+    //    The octave path only depends on the input and settings, so it runs once
+    //  - Linked Stereo: the mid signal runs through the octave divider, the filters
+    //    and the band chains once; each channel applies its own (detuned) ring
+    //    LFO, mix, shaper and noise afterwards
+    enum class StereoSharing
+    {
+        NONE,
+        DUAL_MONO,
+        LINKED
+    };
+
+    static constexpr float dualMonoTolerance = 1.0e-6f;   // -120 dBFS
+
+    StereoSharing chunkSharing = StereoSharing::NONE;
+
+    struct alignas(64) SharedChunk
+    {
+        ChunkArray<float> octave {};                     // Dual mono
+        ChunkArray<ReeseChain::SharedPaths> paths {};    // Linked Stereo
+        ChunkArray<float> bands {};                      // Linked Stereo: processed band sum
+    };
+
+    SharedChunk sharedChunk;
+
+    // Pick the sharing for a chunk, and hand the paths back to the right chains when it ends
+    void updateStereoSharing(const BlockContext& context, int numSamples);
+
+    void runSharedPass(int numSamples);
+
+    // Follows the left ring LFO sample by sample during the control pass, since
+    // the chains only run after it (copied from the chain when a routing starts using it)
+    RingModulator ringLfoTracker;
+    bool ringLfoTracked = false;
+
+    void processChunks(const BlockContext& context, AnalysisTap::BlockWriter& tap, bool allowParallel);
+
+    // Smoothers, control blocks and crossover for one chunk (always on the audio thread)
+    void runControlPass(const BlockContext& context, int chunkStart, int numSamples);
+
+    // Chains of one channel for one chunk; touches only that channel's state
+    void runChannelPass(int channel, float* output, int numSamples);
+
+    static void updateChain(ReeseChain& chain, const ChunkSettings& settings, int channel, int index);
+
+    // Sub and high band chains of one sample, blended by their Character (before volume)
+    static float processBands(ChannelChains& channelChains, const ChunkSettings& settings, int channel, int index,
+                              float subBand, float highBand);
+
+    //==============================================================================
+    // Multi-Core: channels split between the audio thread and a pre-spawned worker
+    static constexpr int minimumParallelSamples = 16;   // Shorter chunks run serially
+
+    RealtimeWorker channelWorker;
+
+    // The worker thread is only started while Multi-Core is on (a project loads
+    // hundreds of instances); switching it on later starts it off the audio thread
+    bool workerAllowed = false;   // Prepared with more than one output channel
+
+    void startChannelWorker();
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    void handleAsyncUpdate() override;
+
+    struct ChannelTask
+    {
+        ReeseDestroyerAudioProcessor* processor;
+        float* const* outputs;
+        int firstChannel;
+        int numChannels;
+        int numSamples;
+    };
+
+    void processChannels(float* const* outputs, int numChannels, int numSamples, bool allowParallel);
+    static void runChannelTask(void* context);
+
+    //==============================================================================
+    // Lock-free metering/spectrum tap (audio thread -> analysis thread -> editor)
+    AnalysisTap analysisTap;
+
+    // Background filter response evaluator (editor only, never the audio thread)
+    FilterResponse filterResponse;
+
+    //==============================================================================
+    // Bypass (the Bypass parameter, or a host calling processBlockBypassed): an
+    // equal-power crossfade to the input, delayed by the reported latency. Once
+    // faded out only the delay runs; releasing bypass restarts the smoothers and
+    // chains from a clean state under the fade-in
+    static constexpr double bypassFadeTime = 0.02;   // 20ms
+
+    LatencyDelay dryDelay;
+    juce::AudioBuffer<float> dryBuffer;          // Delayed input of one segment during a fade
+    juce::SmoothedValue<float> bypassMix;        // 1 processed, 0 bypassed (host rate)
+    bool bypassAsleep = false;                   // Faded out: nothing but the dry delay runs
+
+    // Host blocks in segments of at most preparedBlockSize
+    void processSegments(juce::AudioBuffer<float>& buffer, bool bypassed);
+    void processSegment(juce::AudioBuffer<float>& buffer, bool bypassed);
+
+    // Smoothers at their parameter values, routings rebuilt, processing-rate modules reset
+    void restartProcessing();
+
+    //==============================================================================
+    // Cabinet IR stage at the host rate, before the output stage. The Cabinet switch
+    // and Mix fade the convolved signal in and out; while faded out nothing runs,
+    // and the convolvers restart from silence when it fades back in
+    static constexpr double cabinetFadeTime = 0.02;          // 20ms
+    static constexpr juce::uint32 cabinetChunkTag = 0x62634452;   // 'RDcb': IR path (UTF-8) in the state
+
+    CabinetLoader cabinetLoader;
+    juce::AudioBuffer<float> cabinetDry;        // Unconvolved segment while the mix is below 100%
+    juce::SmoothedValue<float> cabinetMix;      // Host rate
+    bool cabinetRunning = false;
+
+    void processCabinet(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples);
+
+    //==============================================================================
+    // Output stage: zero-latency soft knee (default) or lookahead true-peak limiter
+    TruePeakLimiter outputLimiter;
+    bool truePeakWasActive = false;
+
+    // Latency changes reach the host once they have held this long (not at every
+    // step of a lookahead drag); prepareToPlay() reports at once
+    static constexpr double latencySettleTime = 0.25;   // 250ms
+    int latencySettleSamples = 0;
+    int currentLatency = 0;         // Latency of the output as processed now (the dry path follows it)
+    int currentLatencyAge = 0;      // Samples it has held
+
+    // Apply the output stage parameters and report settled latency; returns true for true-peak mode
+    bool updateOutputStage(int numSamples);
 
     //==============================================================================
     // Utility functions
@@ -0,0 +1,173 @@
+#include "StageTrace.h"
+
+#if REESE_STAGE_TRACE
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    const char* const stageNames[] = {
+        "processBlock", "oversampling", "control pass", "channel pass", "shared pass",
+        "octave", "ring", "filters", "shaper", "noise", "cabinet", "limiter"
+    };
+
+    static_assert(std::size(stageNames) == static_cast<size_t>(StageTrace::numStages), "One name per stage");
+
+    struct Event
+    {
+        std::uint64_t begin;
+        std::uint64_t end;
+        StageTrace::Stage stage;
+        bool aggregated;
+    };
+
+    constexpr int maxThreads = 8;
+    constexpr std::uint64_t eventsPerThread = 1 << 16;
+
+    /**
+     * One recording thread's ring buffer (single writer)
+     */
+    struct ThreadBuffer
+    {
+        std::atomic<bool> claimed { false };
+        std::atomic<std::uint64_t> numWritten { 0 };
+        std::array<Event, eventsPerThread> events;
+
+        void push(const Event& event) noexcept
+        {
+            const auto index = numWritten.load(std::memory_order_relaxed);
+            events[static_cast<size_t>(index % eventsPerThread)] = event;
+            numWritten.store(index + 1, std::memory_order_release);
+        }
+    };
+
+    // Static storage: claiming a buffer on first use never allocates
+    ThreadBuffer buffers[maxThreads];
+    thread_local ThreadBuffer* threadBuffer = nullptr;
+
+    ThreadBuffer* getThreadBuffer() noexcept
+    {
+        if (threadBuffer == nullptr)
+        {
+            for (auto& buffer : buffers)
+            {
+                bool expected = false;
+
+                if (buffer.claimed.compare_exchange_strong(expected, true))
+                {
+                    threadBuffer = &buffer;
+                    break;
+                }
+            }
+        }
+
+        return threadBuffer;   // Null if every buffer is taken: events are dropped
+    }
+
+    // Reference point for converting counter ticks to microseconds
+    const std::uint64_t startTicks = StageTrace::readCycleCounter();
+    const auto startTime = std::chrono::steady_clock::now();
+}
+
+//==============================================================================
+void StageTrace::record(Stage stage, std::uint64_t begin, std::uint64_t end) noexcept
+{
+    auto* buffer = getThreadBuffer();
+
+    if (buffer == nullptr)
+        return;
+
+    buffer->push({ begin, end, stage, false });
+
+    // Lap totals inside this scope become consecutive child slices
+    auto childBegin = begin;
+
+    for (size_t i = 0; i < lapTotals.size(); ++i)
+    {
+        if (lapTotals[i] == 0)
+            continue;
+
+        buffer->push({ childBegin, childBegin + lapTotals[i], static_cast<Stage>(i), true });
+        childBegin += lapTotals[i];
+        lapTotals[i] = 0;
+    }
+}
+
+void StageTrace::reset()
+{
+    for (auto& buffer : buffers)
+        buffer.numWritten.store(0);
+}
+
+bool StageTrace::writeChromeTrace(const juce::File& file)
+{
+    // Calibrate the counter against steady_clock over the whole run (at least 20ms)
+    if (std::chrono::steady_clock::now() - startTime < std::chrono::milliseconds(20))
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    const auto elapsedTicks = static_cast<double>(readCycleCounter() - startTicks);
+    const auto elapsedMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+    const double ticksPerMicrosecond = elapsedTicks / elapsedMicroseconds;
+
+    auto toMicroseconds = [&](std::uint64_t ticks) {
+        return static_cast<double>(static_cast<std::int64_t>(ticks - startTicks)) / ticksPerMicrosecond;
+    };
+
+    juce::MemoryOutputStream json;
+    json << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+    bool first = true;
+    auto separator = [&]() -> const char* {
+        const char* text = first ? "" : ",\n";
+        first = false;
+        return text;
+    };
+
+    for (int thread = 0; thread < maxThreads; ++thread)
+    {
+        const auto& buffer = buffers[thread];
+        const auto numWritten = buffer.numWritten.load(std::memory_order_acquire);
+
+        if (numWritten == 0)
+            continue;
+
+        const auto firstIndex = numWritten > eventsPerThread ? numWritten - eventsPerThread : 0;
+        bool recordsBlocks = false;
+
+        for (auto index = firstIndex; index < numWritten; ++index)
+        {
+            const auto& event = buffer.events[static_cast<size_t>(index % eventsPerThread)];
+            recordsBlocks = recordsBlocks || event.stage == Stage::BLOCK;
+
+            json << separator()
+                 << "{\"name\":\"" << stageNames[static_cast<size_t>(event.stage)] << "\",\"cat\":\""
+                 << (event.aggregated ? "per-sample" : "block") << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread
+                 << ",\"ts\":" << juce::String(toMicroseconds(event.begin), 3)
+                 << ",\"dur\":" << juce::String(static_cast<double>(event.end - event.begin) / ticksPerMicrosecond, 3);
+
+            if (event.aggregated)
+                json << ",\"args\":{\"aggregated\":true}";
+
+            json << "}";
+        }
+
+        // A wrapped buffer says so in the thread name, where the viewer shows it
+        json << separator()
+             << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+             << ",\"args\":{\"name\":\"" << (recordsBlocks ? "Audio thread " : "Worker thread ") << thread;
+
+        if (numWritten > eventsPerThread)
+            json << " (last " << static_cast<int>(eventsPerThread) << " events)";
+
+        json << "\"}}";
+    }
+
+    json << "\n]}\n";
+
+    return file.replaceWithData(json.getData(), json.getDataSize());
+}
+
+#endif
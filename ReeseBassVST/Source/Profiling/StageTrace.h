@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#if REESE_STAGE_TRACE
+ #if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+ #elif defined(_M_X64) || defined(_M_IX86)
+  #include <intrin.h>
+ #else
+  #include <chrono>
+ #endif
+#endif
+
+namespace juce { class File; }
+
+/**
+ * StageTrace - Per-Stage Timing Markers, Exported as Chrome Trace JSON
+ *
+ * Two kinds of marker, both cycle-counter timestamps (rdtsc on x86,
+ * cntvct_el0 on ARM64, steady_clock elsewhere):
+ *
+ * - Scope: one complete event per instance (processBlock, control pass,
+ *   channel pass, oversampling, limiter), written to a per-thread ring
+ *   buffer when it closes. The buffers are static, so recording never
+ *   allocates; when one wraps, the oldest events are overwritten
+ *   (the trace names the thread "... (last N events)").
+ * - Lap: splits per-sample work into stages (octave, ring, filters, shaper,
+ *   noise). Each mark() adds the cycles since the previous mark to that
+ *   stage's per-thread total. When the enclosing Scope closes, the totals
+ *   are emitted as consecutive child slices of it (flagged "aggregated":
+ *   they are sums over the scope's samples, not contiguous intervals).
+ *
+ * writeChromeTrace() dumps every thread's buffer in the Trace Event Format
+ * (chrome://tracing, ui.perfetto.dev). Call it while nothing is recording.
+ *
+ * Only builds configured with -DREESE_STAGE_TRACE=ON record anything;
+ * otherwise the markers are empty inline types and compile away. This
+ * header is JUCE-free so the ReeseDSP library can carry the markers; the
+ * recorder itself (StageTrace.cpp) is built with the plugin sources.
+ */
+namespace StageTrace
+{
+    enum class Stage : std::uint8_t
+    {
+        BLOCK,          // Whole processBlock
+        OVERSAMPLING,   // Up or down conversion (offline profiles)
+        CONTROL_PASS,   // Smoothers, control blocks, crossover
+        CHANNEL_PASS,   // One channel's chains over a chunk
+        SHARED_PASS,    // Chain stages computed once for both channels (dual mono, Linked Stereo)
+        OCTAVE,         // Octave divider
+        RING,           // Ring modulator (both paths)
+        FILTERS,        // The three SVFs
+        SHAPER,         // Path mix and wave shaper
+        NOISE,          // Noise generator
+        CABINET,        // Cabinet IR convolution
+        LIMITER,        // Output stage (soft knee or true-peak limiter)
+        NUM_STAGES
+    };
+
+    constexpr int numStages = static_cast<int>(Stage::NUM_STAGES);
+
+#if REESE_STAGE_TRACE
+    constexpr bool isEnabled() noexcept { return true; }
+
+    inline std::uint64_t readCycleCounter() noexcept
+    {
+       #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        return __rdtsc();
+       #elif defined(__aarch64__) && !defined(_MSC_VER)
+        std::uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+       #else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+       #endif
+    }
+
+    // Lap totals of the current thread, flushed by the enclosing Scope
+    inline thread_local std::array<std::uint64_t, numStages> lapTotals {};
+
+    /**
+     * Append a complete event (and any lap totals) to this thread's buffer
+     */
+    void record(Stage stage, std::uint64_t begin, std::uint64_t end) noexcept;
+
+    class Scope
+    {
+    public:
+        explicit Scope(Stage stageToRecord) noexcept
+            : stage(stageToRecord), begin(readCycleCounter())
+        {
+        }
+
+        ~Scope() noexcept { record(stage, begin, readCycleCounter()); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Stage stage;
+        std::uint64_t begin;
+    };
+
+    class Lap
+    {
+    public:
+        Lap() noexcept : last(readCycleCounter()) {}
+
+        /**
+         * Charge the time since the previous mark to a stage
+         */
+        void mark(Stage stage) noexcept
+        {
+            const auto now = readCycleCounter();
+            lapTotals[static_cast<size_t>(stage)] += now - last;
+            last = now;
+        }
+
+    private:
+        std::uint64_t last;
+    };
+
+    /**
+     * Discard everything recorded so far (call while nothing is recording)
+     */
+    void reset();
+
+    /**
+     * Write all threads' events as Chrome trace JSON (call while nothing is recording)
+     * @return False if the file could not be written
+     */
+    bool writeChromeTrace(const juce::File& file);
+#else
+    constexpr bool isEnabled() noexcept { return false; }
+
+    struct Scope
+    {
+        explicit Scope(Stage) noexcept {}
+    };
+
+    struct Lap
+    {
+        Lap() noexcept {}
+        void mark(Stage) noexcept {}
+    };
+
+    inline void reset() {}
+    inline bool writeChromeTrace(const juce::File&) { return false; }
+#endif
+}
@@ -0,0 +1,255 @@
+#include "AudioThreadGuard.h"
+
+// Only linked into the console apps when REESE_AUDIO_THREAD_GUARD is on:
+// this file replaces the process-wide allocator and pthread lock entry points.
+#if REESE_AUDIO_THREAD_GUARD
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
+
+#if !defined(__linux__) || !defined(__GLIBC__)
+ #error "AudioThreadGuard interposes glibc symbols and only supports Linux"
+#endif
+
+// glibc's allocator entry points, so the replacements need no dlsym
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void* __libc_memalign(size_t, size_t);
+    void __libc_free(void*);
+}
+
+namespace
+{
+    // Per thread: inside an audio scope / inside a report
+    thread_local int audioDepth = 0;
+    thread_local bool reporting = false;
+
+    std::atomic<int> numViolations { 0 };
+
+    // Call sites already printed (hash of the return addresses), fixed size, no allocation
+    constexpr int maxReportedSites = 256;
+    constexpr int maxFrames = 48;
+    std::atomic<std::uintptr_t> reportedSites[maxReportedSites] {};
+
+    bool markSiteReported(std::uintptr_t site)
+    {
+        for (auto& slot : reportedSites)
+        {
+            auto expected = std::uintptr_t { 0 };
+
+            if (slot.compare_exchange_strong(expected, site))
+                return true;
+
+            if (expected == site)
+                return false;
+        }
+
+        return false;   // Table full: count, but stop printing
+    }
+
+    void reportViolation(const char* call)
+    {
+        if (audioDepth == 0 || reporting)
+            return;
+
+        // backtrace() and printing may allocate or lock themselves
+        reporting = true;
+        numViolations.fetch_add(1, std::memory_order_relaxed);
+
+        void* frames[maxFrames];
+        const int numFrames = backtrace(frames, maxFrames);
+
+        std::uintptr_t site = 1469598103934665603ull;
+        for (int i = 0; i < numFrames; ++i)
+            site = (site ^ reinterpret_cast<std::uintptr_t>(frames[i])) * 1099511628211ull;
+
+        if (markSiteReported(site == 0 ? 1 : site))
+        {
+            char header[160];
+            const int length = std::snprintf(header, sizeof(header),
+                                             "\n[AudioThreadGuard] %s on an audio thread:\n", call);
+            if (length > 0)
+                ::write(STDERR_FILENO, header, std::min(static_cast<size_t>(length), sizeof(header) - 1));
+
+            backtrace_symbols_fd(frames + 1, numFrames - 1, STDERR_FILENO);   // Skip reportViolation
+        }
+
+        reporting = false;
+    }
+
+    /**
+     * The real implementation behind an interposed symbol, looked up once
+     * (version pinned where glibc keeps an older default for dlsym)
+     */
+    template <typename Function>
+    Function resolveNext(std::atomic<Function>& slot, const char* name, const char* version = nullptr)
+    {
+        auto function = slot.load(std::memory_order_acquire);
+
+        if (function == nullptr)
+        {
+            void* symbol = version != nullptr ? dlvsym(RTLD_NEXT, name, version) : dlsym(RTLD_NEXT, name);
+            function = reinterpret_cast<Function>(symbol);
+            slot.store(function, std::memory_order_release);
+        }
+
+        return function;
+    }
+
+    struct Warmup
+    {
+        Warmup()
+        {
+            // The first backtrace() loads the unwinder; do it before any audio scope
+            void* frames[4];
+            backtrace(frames, 4);
+        }
+    };
+
+    const Warmup warmup;
+}
+
+//==============================================================================
+AudioThreadGuard::ScopedAudioThread::ScopedAudioThread() noexcept   { ++audioDepth; }
+AudioThreadGuard::ScopedAudioThread::~ScopedAudioThread() noexcept  { --audioDepth; }
+
+int AudioThreadGuard::getNumViolations() noexcept
+{
+    return numViolations.load();
+}
+
+//==============================================================================
+// Allocator (operator new/delete in libstdc++ call these)
+extern "C"
+{
+    void* malloc(size_t size)
+    {
+        reportViolation("malloc");
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size)
+    {
+        reportViolation("calloc");
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* pointer, size_t size)
+    {
+        reportViolation("realloc");
+        return __libc_realloc(pointer, size);
+    }
+
+    void free(void* pointer)
+    {
+        if (pointer != nullptr)
+            reportViolation("free");
+
+        __libc_free(pointer);
+    }
+
+    void* memalign(size_t alignment, size_t size)
+    {
+        reportViolation("memalign");
+        return __libc_memalign(alignment, size);
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size)
+    {
+        reportViolation("aligned_alloc");
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** result, size_t alignment, size_t size)
+    {
+        reportViolation("posix_memalign");
+
+        void* pointer = __libc_memalign(alignment, size);
+        if (pointer == nullptr)
+            return ENOMEM;
+
+        *result = pointer;
+        return 0;
+    }
+}
+
+//==============================================================================
+// Blocking primitives (std::mutex, juce::CriticalSection, juce::WaitableEvent, ...)
+// Raw futex syscalls (std::atomic::wait) bypass libc and are not seen.
+namespace
+{
+    using MutexFunction = int (*)(pthread_mutex_t*);
+    using RwLockFunction = int (*)(pthread_rwlock_t*);
+    using CondWaitFunction = int (*)(pthread_cond_t*, pthread_mutex_t*);
+    using CondTimedWaitFunction = int (*)(pthread_cond_t*, pthread_mutex_t*, const struct timespec*);
+    using SemaphoreFunction = int (*)(sem_t*);
+
+    // Constant-initialized: usable before static constructors run
+    std::atomic<MutexFunction> nextMutexLock { nullptr };
+    std::atomic<MutexFunction> nextMutexTryLock { nullptr };
+    std::atomic<RwLockFunction> nextRwLockRead { nullptr };
+    std::atomic<RwLockFunction> nextRwLockWrite { nullptr };
+    std::atomic<CondWaitFunction> nextCondWait { nullptr };
+    std::atomic<CondTimedWaitFunction> nextCondTimedWait { nullptr };
+    std::atomic<SemaphoreFunction> nextSemaphoreWait { nullptr };
+}
+
+extern "C"
+{
+    int pthread_mutex_lock(pthread_mutex_t* mutex)
+    {
+        reportViolation("pthread_mutex_lock");
+        return resolveNext(nextMutexLock, "pthread_mutex_lock")(mutex);
+    }
+
+    int pthread_mutex_trylock(pthread_mutex_t* mutex)
+    {
+        reportViolation("pthread_mutex_trylock");
+        return resolveNext(nextMutexTryLock, "pthread_mutex_trylock")(mutex);
+    }
+
+    int pthread_rwlock_rdlock(pthread_rwlock_t* lock)
+    {
+        reportViolation("pthread_rwlock_rdlock");
+        return resolveNext(nextRwLockRead, "pthread_rwlock_rdlock")(lock);
+    }
+
+    int pthread_rwlock_wrlock(pthread_rwlock_t* lock)
+    {
+        reportViolation("pthread_rwlock_wrlock");
+        return resolveNext(nextRwLockWrite, "pthread_rwlock_wrlock")(lock);
+    }
+
+    // Plain dlsym() returns the pre-2.3.2 compatibility condition variable
+    int pthread_cond_wait(pthread_cond_t* condition, pthread_mutex_t* mutex)
+    {
+        reportViolation("pthread_cond_wait");
+        return resolveNext(nextCondWait, "pthread_cond_wait", "GLIBC_2.3.2")(condition, mutex);
+    }
+
+    int pthread_cond_timedwait(pthread_cond_t* condition, pthread_mutex_t* mutex, const struct timespec* time)
+    {
+        reportViolation("pthread_cond_timedwait");
+        return resolveNext(nextCondTimedWait, "pthread_cond_timedwait", "GLIBC_2.3.2")(condition, mutex, time);
+    }
+
+    int sem_wait(sem_t* semaphore)
+    {
+        reportViolation("sem_wait");
+        return resolveNext(nextSemaphoreWait, "sem_wait")(semaphore);
+    }
+}
+
+#endif
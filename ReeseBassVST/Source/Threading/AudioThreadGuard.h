@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * AudioThreadGuard - Allocation and Lock Detector for Test Builds
+ *
+ * processBlock and the Multi-Core worker's task mark their thread as an
+ * audio thread for their duration. In builds configured with
+ * -DREESE_AUDIO_THREAD_GUARD=ON (ReeseBenchmarks / ReeseNullTests, Linux),
+ * AudioThreadGuard.cpp interposes the C allocator (malloc/free/..., which
+ * operator new/delete go through) and the pthread blocking primitives
+ * (mutexes, rwlocks, condition waits, semaphores, which std::mutex,
+ * juce::CriticalSection and juce::WaitableEvent are built on). Any call on a
+ * marked thread is counted and its stack trace printed once per call site.
+ *
+ * There is no exemption scope: a lock or allocation on the audio thread is
+ * always a failure. In every other build the scope is empty and compiles away.
+ *
+ * Usage:
+ *   const AudioThreadGuard::ScopedAudioThread audioThread;   // processBlock
+ */
+namespace AudioThreadGuard
+{
+#if REESE_AUDIO_THREAD_GUARD
+    constexpr bool isEnabled() noexcept { return true; }
+
+    /**
+     * Marks the current thread as an audio thread (nests)
+     */
+    struct ScopedAudioThread
+    {
+        ScopedAudioThread() noexcept;
+        ~ScopedAudioThread() noexcept;
+
+        ScopedAudioThread(const ScopedAudioThread&) = delete;
+        ScopedAudioThread& operator=(const ScopedAudioThread&) = delete;
+    };
+
+    /**
+     * Allocations and lock calls seen on audio threads so far (all threads)
+     */
+    int getNumViolations() noexcept;
+#else
+    constexpr bool isEnabled() noexcept { return false; }
+
+    struct ScopedAudioThread
+    {
+        ScopedAudioThread() noexcept {}
+    };
+
+    inline int getNumViolations() noexcept { return 0; }
+#endif
+}
@@ -0,0 +1,109 @@
+#include "RealtimeWorker.h"
+#include "AudioThreadGuard.h"
+#include <thread>
+
+RealtimeWorker::RealtimeWorker()
+    : juce::Thread("Reese Destroyer Worker")
+{
+}
+
+RealtimeWorker::~RealtimeWorker()
+{
+    stop();
+}
+
+bool RealtimeWorker::start(int samplesPerBlock, double sampleRate)
+{
+    const double blockSeconds = juce::jmax(1, samplesPerBlock) / sampleRate;
+    spinTicks.store(juce::Time::secondsToHighResolutionTicks(juce::jmin(maxSpinSeconds, spinPeriods * blockSeconds)));
+
+    if (isThreadRunning())
+        return true;
+
+    // A second thread only competes with the audio thread on a single core
+    if (juce::SystemStats::getNumCpus() < 2)
+        return false;
+
+    state.store(IDLE);
+
+    const auto options = juce::Thread::RealtimeOptions{}
+                             .withApproximateAudioProcessingTime(juce::jmax(1, samplesPerBlock), sampleRate);
+
+    // Realtime scheduling can be refused (sandboxed hosts, missing entitlements)
+    return startRealtimeThread(options) || startThread(juce::Thread::Priority::highest);
+}
+
+void RealtimeWorker::stop()
+{
+    signalThreadShouldExit();
+    state.store(EXITING);
+    state.notify_one();
+    stopThread(1000);
+}
+
+//==============================================================================
+void RealtimeWorker::dispatch(Task task, void* context) noexcept
+{
+    jassert(state.load(std::memory_order_relaxed) != PENDING);
+
+    pendingTask = task;
+    pendingContext = context;
+
+    // Publish, then wake the worker only if it has gone to sleep.
+    // Both sides use sequentially consistent operations on state/sleeping,
+    // so either the worker sees PENDING or we see it sleeping.
+    state.store(PENDING);
+
+    // The worker sleeps whenever blocks are further apart than its spin time,
+    // so this runs every block then: a futex wake (ulock on macOS,
+    // WakeByAddress on Windows), no lock
+    if (sleeping.load())
+        state.notify_one();
+}
+
+void RealtimeWorker::join() noexcept
+{
+    for (int spin = 0; state.load(std::memory_order_acquire) == PENDING; ++spin)
+        if (spin >= joinSpinCount)
+            std::this_thread::yield();
+
+    state.store(IDLE, std::memory_order_relaxed);
+}
+
+//==============================================================================
+void RealtimeWorker::run()
+{
+    while (waitForTask())
+    {
+        const AudioThreadGuard::ScopedAudioThread audioThreadScope;
+        pendingTask(pendingContext);
+        state.store(DONE, std::memory_order_release);
+    }
+}
+
+bool RealtimeWorker::waitForTask()
+{
+    while (!threadShouldExit())
+    {
+        // Spin first: in a steady stream of callbacks the next task arrives within a block period
+        const auto spinEnd = juce::Time::getHighResolutionTicks() + spinTicks.load(std::memory_order_relaxed);
+
+        do
+        {
+            for (int spin = 0; spin < 64; ++spin)
+                if (state.load(std::memory_order_acquire) == PENDING)
+                    return true;
+        }
+        while (juce::Time::getHighResolutionTicks() < spinEnd && !threadShouldExit());
+
+        sleeping.store(true);
+
+        // Blocks while state still holds this value (returns at once if it changed)
+        if (const int current = state.load(); current == IDLE || current == DONE)
+            state.wait(current);
+
+        sleeping.store(false);
+    }
+
+    return false;
+}
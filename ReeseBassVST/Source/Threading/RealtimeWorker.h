@@ -0,0 +1,94 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+
+/**
+ * RealtimeWorker - One Pre-Spawned Helper Thread for the Audio Callback
+ *
+ * Runs one task at a time alongside the audio thread:
+ *
+ *   audio thread:  dispatch(task) -> do its own share -> join()
+ *   worker:        runs task, marks it done, spins briefly for the next one
+ *
+ * The thread is started outside the audio callback (prepareToPlay) with
+ * realtime priority sized for the host's block period, and sleeps when idle.
+ *
+ * Synchronization is a spin-then-wait barrier on atomics, nothing allocates:
+ * - The worker spins for a little over one block period after each task,
+ *   so in a steady stream of callbacks the next dispatch is picked up
+ *   without an OS wake-up. After that it sleeps on the state word itself
+ *   (std::atomic wait) and dispatch() wakes it with notify_one(), a
+ *   lock-free futex wake. The spin is capped, so at large block sizes
+ *   (where a wake-up is cheap relative to the work) the worker mostly sleeps.
+ * - join() only spins (yielding after a while), the audio thread never
+ *   blocks or takes a lock.
+ *
+ * Tasks are a plain function pointer and context, no std::function.
+ */
+class RealtimeWorker : private juce::Thread
+{
+public:
+    using Task = void (*)(void* context);
+
+    RealtimeWorker();
+    ~RealtimeWorker() override;
+
+    /**
+     * Start the worker, or update its spin time if it is running
+     * (call outside the audio callback)
+     * @param samplesPerBlock Expected block size (realtime period and spin time)
+     * @param sampleRate The sample rate in Hz
+     * @return True if the worker is running
+     */
+    bool start(int samplesPerBlock, double sampleRate);
+
+    /**
+     * Stop the worker (call outside the audio callback)
+     */
+    void stop();
+
+    /**
+     * True if tasks can be dispatched
+     */
+    bool isReady() const noexcept { return isThreadRunning(); }
+
+    /**
+     * Hand a task to the worker (audio thread; the previous task must be joined)
+     * @param task Function to run on the worker
+     * @param context Argument passed to the task
+     */
+    void dispatch(Task task, void* context) noexcept;
+
+    /**
+     * Wait for the dispatched task to finish (audio thread, spins)
+     */
+    void join() noexcept;
+
+private:
+    enum State : int
+    {
+        IDLE,
+        PENDING,
+        DONE,
+        EXITING     // Set by stop() to wake a sleeping worker
+    };
+
+    // Worker spin time is one block period plus margin, up to maxSpinSeconds
+    static constexpr double spinPeriods = 1.25;
+    static constexpr double maxSpinSeconds = 0.002;
+
+    // Spins before join() starts yielding
+    static constexpr int joinSpinCount = 2000;
+
+    std::atomic<int> state { IDLE };
+    std::atomic<juce::int64> spinTicks { 0 };
+    std::atomic<bool> sleeping { false };
+    Task pendingTask = nullptr;
+    void* pendingContext = nullptr;
+
+    void run() override;
+    bool waitForTask();
+
+    JUCE_DECLARE_NON_COPYABLE(RealtimeWorker)
+};
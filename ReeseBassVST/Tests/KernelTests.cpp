@@ -0,0 +1,934 @@
+#include "NullTestUtils.h"
+#include "DSP/SimdFloat.h"
+#include "DSP/OctaveDivider.h"
+#include "DSP/LinkwitzRileyCrossover.h"
+#include "DSP/EnvelopeFollower.h"
+#include "DSP/StateVariableFilter.h"
+#include "DSP/LadderFilter.h"
+#include "DSP/TruePeakLimiter.h"
+#include "DSP/SharedTables.h"
+#include "DSP/RealFFT.h"
+#include "DSP/PartitionedConvolver.h"
+#include "Analysis/FilterResponse.h"
+#include <complex>
+#include <numbers>
+
+/**
+ * KernelTests - Optimized DSP modules against scalar references
+ *
+ * Each optimized kernel (SIMD lanes, packed filter banks, block-rate
+ * detectors, background-evaluated curves) is run next to a straightforward
+ * scalar, mostly double-precision implementation of the same maths. The
+ * thresholds are per module: exact for element-wise SIMD, float rounding
+ * for the recursive filters and transforms, measurement accuracy for the
+ * response curves.
+ */
+namespace
+{
+    using namespace NullTestUtils;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int numSamples = 96000;
+
+    //==============================================================================
+    template <int Lanes>
+    void testSimdVector(const char* label)
+    {
+        using Vec = SimdVector<Lanes>;
+        constexpr int count = 1024;
+
+        juce::Random random(Lanes);
+        std::vector<float> a(count), b(count);
+        for (int i = 0; i < count; ++i)
+        {
+            a[static_cast<size_t>(i)] = random.nextFloat() * 4.0f - 2.0f;
+            b[static_cast<size_t>(i)] = random.nextFloat() * 4.0f + 0.5f;   // Nonzero divisor
+        }
+
+        struct Operation
+        {
+            const char* name;
+            Vec (*vector)(Vec, Vec);
+            float (*scalar)(float, float);
+        };
+
+        const Operation operations[] = {
+            { "add", [](Vec x, Vec y) { return x + y; },          [](float x, float y) { return x + y; } },
+            { "sub", [](Vec x, Vec y) { return x - y; },          [](float x, float y) { return x - y; } },
+            { "mul", [](Vec x, Vec y) { return x * y; },          [](float x, float y) { return x * y; } },
+            { "div", [](Vec x, Vec y) { return x / y; },          [](float x, float y) { return x / y; } },
+            { "min", [](Vec x, Vec y) { return Vec::min(x, y); }, [](float x, float y) { return y < x ? y : x; } },
+            { "max", [](Vec x, Vec y) { return Vec::max(x, y); }, [](float x, float y) { return x < y ? y : x; } },
+            { "abs", [](Vec x, Vec)   { return Vec::abs(x); },    [](float x, float)   { return std::abs(x); } },
+            { "lt/select", [](Vec x, Vec y) { return Vec::select(Vec::lessThan(x, y), x - y, y); },
+                           [](float x, float y) { return x < y ? x - y : y; } },
+            { "gt/select", [](Vec x, Vec y) { return Vec::select(Vec::greaterThan(x, y), y, x * y); },
+                           [](float x, float y) { return x > y ? y : x * y; } },
+        };
+
+        for (const auto& operation : operations)
+        {
+            std::vector<float> expected(count), actual(count);
+
+            for (int i = 0; i < count; i += Lanes)
+            {
+                operation.vector(Vec::load(a.data() + i), Vec::load(b.data() + i)).store(actual.data() + i);
+
+                for (int lane = 0; lane < Lanes; ++lane)
+                    expected[static_cast<size_t>(i + lane)] = operation.scalar(a[static_cast<size_t>(i + lane)], b[static_cast<size_t>(i + lane)]);
+            }
+
+            // Element-wise IEEE operations: bit-exact
+            expectNull(juce::String(label) + " " + operation.name, expected, actual, -200.0);
+        }
+
+        // Horizontal reductions (summation order differs from the scalar loop)
+        double worstMax = 0.0, worstSum = 0.0;
+
+        for (int i = 0; i < count; i += Lanes)
+        {
+            float scalarMax = a[static_cast<size_t>(i)];
+            double scalarSum = 0.0;
+
+            for (int lane = 0; lane < Lanes; ++lane)
+            {
+                scalarMax = juce::jmax(scalarMax, a[static_cast<size_t>(i + lane)]);
+                scalarSum += a[static_cast<size_t>(i + lane)];
+            }
+
+            const auto v = Vec::load(a.data() + i);
+            worstMax = juce::jmax(worstMax, static_cast<double>(std::abs(maxElement(v) - scalarMax)));
+            worstSum = juce::jmax(worstSum, std::abs(static_cast<double>(sumElements(v)) - scalarSum));
+        }
+
+        expectNear(juce::String(label) + " maxElement", worstMax, 0.0, 0.0);
+        expectNear(juce::String(label) + " sumElements", worstSum, 0.0, 1.0e-5);
+    }
+
+    //==============================================================================
+    /**
+     * Double-precision trapezoidal SVF section (one lane of SvfBank)
+     */
+    struct ReferenceSvf
+    {
+        double g = 0.0, k = 0.0, s1 = 0.0, s2 = 0.0;
+
+        ReferenceSvf(double cutoffHz, double damping)
+            : g(std::tan(juce::MathConstants<double>::pi * juce::jmin(cutoffHz, sampleRate * 0.49) / sampleRate)),
+              k(damping)
+        {
+        }
+
+        void tick(double x, double& lowPass, double& bandPass, double& highPass)
+        {
+            highPass = (x - (k + g) * s1 - s2) / (1.0 + g * k + g * g);
+            bandPass = g * highPass + s1;
+            s1 = g * highPass + bandPass;
+            lowPass = g * bandPass + s2;
+            s2 = g * bandPass + lowPass;
+        }
+    };
+
+    /**
+     * One channel of the LR4 split, section by section (no lane packing)
+     */
+    struct ReferenceCrossover
+    {
+        static constexpr double k = 1.4142135623730951;
+
+        ReferenceSvf split1, low1, high1, allPass2, split2, low2, high2;
+
+        ReferenceCrossover(double lowHz, double highHz)
+            : split1(lowHz, k), low1(lowHz, k), high1(lowHz, k),
+              allPass2(highHz, k), split2(highHz, k), low2(highHz, k), high2(highHz, k)
+        {
+        }
+
+        void process(double x, double& sub, double& mid, double& high)
+        {
+            double lp, bp, hp, lowBand, highBand, unusedBp, unusedOther;
+
+            split1.tick(x, lp, bp, hp);
+            low1.tick(lp, lowBand, unusedBp, unusedOther);
+            high1.tick(hp, unusedOther, unusedBp, highBand);
+
+            allPass2.tick(lowBand, unusedOther, bp, hp);
+            sub = lowBand - 2.0 * k * bp;
+
+            split2.tick(highBand, lp, bp, hp);
+            low2.tick(lp, mid, unusedBp, unusedOther);
+            high2.tick(hp, unusedOther, unusedBp, high);
+        }
+    };
+
+    void testCrossover(const GoldenSignal& signal)
+    {
+        constexpr float lowHz = 120.0f, highHz = 2000.0f;
+
+        LinkwitzRileyCrossover crossover;
+        crossover.prepare(sampleRate);
+        crossover.setCrossoverFrequencies(lowHz, highHz);
+
+        ReferenceCrossover reference[2] = { { lowHz, highHz }, { lowHz, highHz } };
+
+        const auto size = signal.left.size();
+        std::vector<float> expected[3], actual[3];
+        for (int band = 0; band < 3; ++band)
+        {
+            expected[band].resize(size * 2);
+            actual[band].resize(size * 2);
+        }
+
+        double inputEnergy = 0.0, sumEnergy = 0.0;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            const float inputs[2] = { signal.left[i], signal.right[i] };
+            const auto split = crossover.processSample(inputs[0], inputs[1]);
+
+            for (size_t channel = 0; channel < 2; ++channel)
+            {
+                double sub, mid, high;
+                reference[channel].process(inputs[channel], sub, mid, high);
+
+                const size_t index = i * 2 + channel;
+                expected[0][index] = static_cast<float>(sub);
+                expected[1][index] = static_cast<float>(mid);
+                expected[2][index] = static_cast<float>(high);
+                actual[0][index] = split.sub[channel];
+                actual[1][index] = split.mid[channel];
+                actual[2][index] = split.high[channel];
+
+                const double bandSum = static_cast<double>(split.sub[channel]) + split.mid[channel] + split.high[channel];
+                inputEnergy += static_cast<double>(inputs[channel]) * inputs[channel];
+                sumEnergy += bandSum * bandSum;
+            }
+        }
+
+        // Relative to the input: a band can be legitimately near silent (41Hz in the high band)
+        const double inputRms = std::sqrt(inputEnergy / static_cast<double>(juce::jmax<size_t>(1, size * 2)));
+        const juce::String prefix = juce::String("crossover ") + signal.name;
+        const char* bandNames[] = { " sub", " mid", " high" };
+
+        for (int band = 0; band < 3; ++band)
+            expectResidual(prefix + bandNames[band], residualDb(expected[band], actual[band], inputRms), -90.0);
+
+        // The bands sum to an allpass: same energy as the input
+        if (inputEnergy > 0.0)
+            expectNear(prefix + " band sum energy (dB)", 10.0 * std::log10(sumEnergy / inputEnergy), 0.0, 0.05);
+    }
+
+    //==============================================================================
+    void testEnvelopeFollower(const GoldenSignal& signal, EnvelopeFollower::DetectorMode mode, int blockSize)
+    {
+        constexpr float attackMs = 2.0f, releaseMs = 80.0f;
+
+        EnvelopeFollower follower;
+        follower.prepare(sampleRate);
+        follower.setAttack(attackMs);
+        follower.setRelease(releaseMs);
+        follower.setMode(mode);
+
+        const float* channels[2] = { signal.left.data(), signal.right.data() };
+        const int length = static_cast<int>(signal.left.size());
+
+        std::vector<float> expected, actual;
+        double envelope = 0.0;
+
+        for (int start = 0; start < length; start += blockSize)
+        {
+            const int n = juce::jmin(blockSize, length - start);
+            actual.push_back(follower.process(channels, 2, start, n));
+
+            // Scalar detector over both channels
+            double level = 0.0;
+            for (const float* channel : channels)
+                for (int i = start; i < start + n; ++i)
+                    level = mode == EnvelopeFollower::DetectorMode::PEAK
+                          ? juce::jmax(level, static_cast<double>(std::abs(channel[i])))
+                          : level + static_cast<double>(channel[i]) * channel[i];
+
+            if (mode == EnvelopeFollower::DetectorMode::RMS)
+                level = std::sqrt(level / (2.0 * n));
+
+            const double timeMs = level > envelope ? attackMs : releaseMs;
+            envelope = level + std::exp(-n / (timeMs * 0.001 * sampleRate)) * (envelope - level);
+            expected.push_back(static_cast<float>(envelope));
+        }
+
+        expectNull(juce::String("envelope ") + signal.name
+                       + (mode == EnvelopeFollower::DetectorMode::PEAK ? " peak/" : " rms/") + juce::String(blockSize),
+                   expected, actual, -100.0);
+    }
+
+    //==============================================================================
+    /**
+     * Shared lookup tables against the double-precision functions they replace
+     */
+    void testSharedTable(const char* label, SharedTables::Type type, double minInput, double maxInput,
+                         double (*reference)(double), bool relative, bool odd)
+    {
+        const auto table = SharedTables::acquire(type);
+        constexpr int numPoints = 100000;
+        double worst = 0.0;
+
+        for (int i = 0; i <= numPoints; ++i)
+        {
+            const auto input = static_cast<float>(minInput + (maxInput - minInput) * i / numPoints);
+            const double expected = reference(input);
+            const double actual = odd ? table->lookupOdd(-input) : table->lookup(input);
+            const double error = std::abs((odd ? -actual : actual) - expected);
+
+            worst = std::max(worst, relative ? error / std::abs(expected) : error);
+        }
+
+        report(juce::String("shared table ") + label, worst < 1.0e-6,
+               juce::String(worst, 9) + (relative ? " relative" : " absolute") + " (limit 1e-6)");
+    }
+
+    void testSharedTables()
+    {
+        constexpr double pi = std::numbers::pi;
+
+        testSharedTable("tanh (odd)", SharedTables::Type::TANH, 0.0, 20.0,
+                        [](double x) { return std::tanh(x); }, false, true);
+        // Up to 20 kHz at 44.1 kHz: nearer the pole the float input's own rounding dominates
+        testSharedTable("tan prewarp", SharedTables::Type::TAN_PREWARP, 1.0e-4, 20000.0 / 44100.0,
+                        [](double f) { return std::tan(pi * f); }, true, false);
+        testSharedTable("sine cycle", SharedTables::Type::SINE_CYCLE, 0.0, 1.0,
+                        [](double p) { return std::sin(2.0 * pi * p); }, false, false);
+        testSharedTable("modified sine cycle", SharedTables::Type::MODIFIED_SINE_CYCLE, 0.0, 1.0,
+                        [](double p) { return std::tanh((std::sin(2.0 * pi * p) + 0.15 * std::sin(6.0 * pi * p)) * 1.3); },
+                        false, false);
+        testSharedTable("decibels to gain", SharedTables::Type::DECIBELS_TO_GAIN, -100.0, 24.0,
+                        [](double db) { return std::pow(10.0, db / 20.0); }, true, false);
+
+        // One copy per process while any holder is alive, freed with the last
+        const int liveBefore = SharedTables::getNumLiveTables();
+        auto first = SharedTables::acquire(SharedTables::Type::TANH);
+        auto second = SharedTables::acquire(SharedTables::Type::TANH);
+        report("shared table acquired once", first == second && SharedTables::getNumLiveTables() == liveBefore + 1,
+               "same table for every holder");
+
+        first.reset();
+        second.reset();
+        report("shared table freed with last holder", SharedTables::getNumLiveTables() == liveBefore,
+               juce::String(SharedTables::getNumLiveTables()) + " live");
+    }
+
+    //==============================================================================
+    /**
+     * Measured gain of the SVF and ladder low-passes against the analytic curves the editor draws
+     */
+    void testFilterResponse()
+    {
+        // On the cache quantization grid (1/48 octave, 1/400), so the curves are for exactly these settings
+        constexpr float cutoffHz = 640.0f;
+        constexpr float resonance = 0.5f;
+
+        FilterResponse response;
+        response.setSampleRate(sampleRate);
+        response.addView();
+
+        // One model at a time: a miss replaces the worker's pending request
+        auto fetch = [&](FilterResponse::Model model, FilterResponse::Curve& curve)
+        {
+            for (int attempt = 0; attempt < 400; ++attempt)
+            {
+                if (response.getCurve(model, cutoffHz, resonance, curve))
+                    return true;
+
+                juce::Thread::sleep(5);
+            }
+
+            return false;
+        };
+
+        FilterResponse::Curve svfCurve, ladderCurve;
+        const bool found = fetch(FilterResponse::Model::SVF, svfCurve)
+                        && fetch(FilterResponse::Model::LADDER, ladderCurve);
+
+        response.removeView();
+
+        if (!report("filter response curves computed", found, "background worker"))
+            return;
+
+        report("filter response cache keys by model", svfCurve.key != ladderCurve.key, "");
+
+        StateVariableFilter svf;
+        LadderFilter ladder;
+
+        // Gain of one filter at the grid frequency, measured with a -60 dBFS sine
+        // (keeps the saturation of both models out of the measurement)
+        auto measureDb = [](double hz, auto&& processSample)
+        {
+            constexpr double amplitude = 0.001;
+            const int settle = static_cast<int>(sampleRate / 4);
+            const int periods = juce::jmax(1, static_cast<int>(hz));   // About one second, whole periods
+            const int length = juce::roundToInt(periods * sampleRate / hz);
+
+            double inputEnergy = 0.0, outputEnergy = 0.0;
+
+            for (int i = 0; i < settle + length; ++i)
+            {
+                const double x = amplitude * std::sin(juce::MathConstants<double>::twoPi * hz * i / sampleRate);
+                const double y = processSample(static_cast<float>(x));
+
+                if (i >= settle)
+                {
+                    inputEnergy += x * x;
+                    outputEnergy += y * y;
+                }
+            }
+
+            return 10.0 * std::log10(outputEnergy / inputEnergy);
+        };
+
+        for (const int index : { 32, 64, 96, 128, 160, 192, 224 })
+        {
+            const double hz = FilterResponse::getGridFrequency(index);
+
+            svf.prepare(sampleRate);
+            svf.setCutoff(cutoffHz);
+            svf.setResonance(resonance);
+
+            ladder.prepare(sampleRate);
+            ladder.setCutoff(cutoffHz);
+            ladder.setResonance(resonance);
+
+            const double svfDb = measureDb(hz, [&](float x) { return svf.processSample(x).lowPass; });
+            const double ladderDb = measureDb(hz, [&](float x) { return ladder.processSample(x); });
+
+            expectNear("SVF response at " + juce::String(hz, 0) + "Hz (dB)",
+                       svfDb, svfCurve.singleDb[static_cast<size_t>(index)], 0.05);
+            expectNear("ladder response at " + juce::String(hz, 0) + "Hz (dB)",
+                       ladderDb, ladderCurve.singleDb[static_cast<size_t>(index)], 0.05);
+        }
+    }
+
+    //==============================================================================
+    /**
+     * The nonlinear ladder equations solved to convergence in double with std::tanh:
+     * the same linearization, iterated until no operating point moves (at the fixed
+     * point tanh(v) = slope * v exactly, so this is the trapezoidal solution itself)
+     */
+    struct ReferenceLadder
+    {
+        double g = 0.0;
+        double k = 0.0;
+        std::array<double, 4> state {};
+        std::array<double, 5> point {};
+
+        double process(double u)
+        {
+            std::array<double, 5> slope, solution {};
+
+            for (int iteration = 0; iteration < 100; ++iteration)
+            {
+                for (size_t i = 0; i < 5; ++i)
+                    slope[i] = std::abs(point[i]) < 1.0e-12 ? 1.0 : std::tanh(point[i]) / point[i];
+
+                double a = 1.0, b = 0.0;
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    const double denominator = 1.0 + g * slope[i + 1];
+                    a = g * slope[i] * a / denominator;
+                    b = (state[i] + g * slope[i] * b) / denominator;
+                }
+
+                solution[0] = (u - k * b) / (1.0 + k * a);
+                for (size_t i = 0; i < 4; ++i)
+                    solution[i + 1] = (state[i] + g * slope[i] * solution[i]) / (1.0 + g * slope[i + 1]);
+
+                double largestMove = 0.0;
+                for (size_t i = 0; i < 5; ++i)
+                    largestMove = juce::jmax(largestMove, std::abs(solution[i] - point[i]));
+
+                point = solution;
+                if (largestMove < 1.0e-13)
+                    break;
+            }
+
+            for (size_t i = 0; i < 4; ++i)
+                state[i] = 2.0 * solution[i + 1] - state[i];
+
+            return solution[4] * (1.0 + k);
+        }
+    };
+
+    void testLadder(const GoldenSignal& signal)
+    {
+        constexpr float cutoffHz = 500.0f;
+        constexpr float resonance = 0.9f;
+
+        LadderFilter ladder;
+        ladder.prepare(sampleRate);
+        ladder.setCutoff(cutoffHz);
+        ladder.setResonance(resonance);
+
+        ReferenceLadder reference;
+        reference.g = std::tan(std::numbers::pi * cutoffHz / sampleRate);
+        reference.k = resonance * 4.0;
+
+        std::vector<float> output(signal.left.size()), expected(signal.left.size());
+
+        for (size_t i = 0; i < output.size(); ++i)
+        {
+            output[i] = ladder.processSample(signal.left[i]);
+            expected[i] = static_cast<float>(reference.process(signal.left[i]));
+        }
+
+        expectNull(juce::String("ladder bounded solver vs converged ") + signal.name, expected, output, -90.0);
+    }
+
+    void testLadderSmallSignal()
+    {
+        // At -60 dBFS every tanh is linear: the 4-pole bilinear ladder, gain-compensated
+        for (const float resonance : { 0.0f, 0.5f, 0.9f })
+        {
+            for (const double hz : { 100.0, 500.0, 1000.0, 3000.0 })
+            {
+                LadderFilter ladder;
+                ladder.prepare(sampleRate);
+                ladder.setCutoff(1000.0f);
+                ladder.setResonance(resonance);
+
+                constexpr double amplitude = 0.001;
+                const int settle = static_cast<int>(sampleRate / 2);
+                const int length = static_cast<int>(sampleRate / 2);
+                double inputEnergy = 0.0, outputEnergy = 0.0;
+
+                for (int i = 0; i < settle + length; ++i)
+                {
+                    const double x = amplitude * std::sin(2.0 * std::numbers::pi * hz * i / sampleRate);
+                    const double y = ladder.processSample(static_cast<float>(x));
+
+                    if (i >= settle)
+                    {
+                        inputEnergy += x * x;
+                        outputEnergy += y * y;
+                    }
+                }
+
+                const double g = std::tan(std::numbers::pi * 1000.0 / sampleRate);
+                const double k = resonance * 4.0;
+                const auto z = std::polar(1.0, 2.0 * std::numbers::pi * hz / sampleRate);
+                const auto stage = g * (1.0 + 1.0 / z) / ((1.0 + g) - (1.0 - g) / z);
+                const auto poles = stage * stage * stage * stage;
+                const double expectedDb = 20.0 * std::log10(std::abs(poles / (1.0 + k * poles)) * (1.0 + k));
+
+                expectNear("ladder small-signal response " + juce::String(resonance, 1) + " at "
+                               + juce::String(hz, 0) + "Hz (dB)",
+                           10.0 * std::log10(outputEnergy / inputEnergy), expectedDb, 0.05);
+            }
+        }
+    }
+
+    //==============================================================================
+    /**
+     * Energy away from the harmonics of a periodic signal, relative to the total
+     * (Blackman-Harris window, so leakage stays below the alias floor)
+     */
+    double inharmonicDb(const std::vector<float>& signal, double fundamentalHz)
+    {
+        constexpr int order = 15;
+        const RealFFT fft(order);
+        const int size = fft.getSize();
+        jassert(static_cast<int>(signal.size()) >= size);
+
+        std::vector<float> windowed(static_cast<size_t>(size)), scratch(windowed.size());
+        std::vector<float> real(static_cast<size_t>(fft.getNumBins())), imag(real.size());
+
+        for (int n = 0; n < size; ++n)
+        {
+            const double phase = 2.0 * std::numbers::pi * n / size;
+            const double window = 0.35875 - 0.48829 * std::cos(phase) + 0.14128 * std::cos(2.0 * phase) - 0.01168 * std::cos(3.0 * phase);
+            windowed[static_cast<size_t>(n)] = static_cast<float>(signal[signal.size() - static_cast<size_t>(size) + static_cast<size_t>(n)] * window);
+        }
+
+        fft.forward(windowed.data(), real.data(), imag.data(), scratch.data());
+
+        const double binHz = sampleRate / size;
+        double total = 0.0, inharmonic = 0.0;
+
+        for (size_t bin = 1; bin < real.size(); ++bin)
+        {
+            const double power = static_cast<double>(real[bin]) * real[bin] + static_cast<double>(imag[bin]) * imag[bin];
+            const double harmonic = static_cast<double>(bin) * binHz / fundamentalHz;
+            const double distance = std::abs(harmonic - std::round(harmonic)) * fundamentalHz / binHz;
+
+            total += power;
+            if (distance > 6.0)
+                inharmonic += power;
+        }
+
+        return 10.0 * std::log10(juce::jmax(inharmonic, 1.0e-30) / total);
+    }
+
+    /**
+     * The band-limited divider against a naive one (steps on whole samples,
+     * same comparator and smoothing): same level, far less aliasing
+     */
+    void testOctaveDividerAliasing(double hz)
+    {
+        OctaveDivider divider;
+        divider.prepare(sampleRate);
+
+        const float n = std::tan(std::numbers::pi_v<float> * static_cast<float>(300.0 / sampleRate));
+        const float b0 = n / (n + 1.0f);
+        const float a1 = (n - 1.0f) / (n + 1.0f);
+        constexpr float trigger = 0.005f + 0.002f;
+
+        bool comparator = false, flipFlop = false;
+        float smoothing = 0.0f;
+
+        const int length = (1 << 15) + 4800;
+        std::vector<float> bandLimited(static_cast<size_t>(length)), naive(static_cast<size_t>(length));
+
+        for (int i = 0; i < length; ++i)
+        {
+            const auto x = static_cast<float>(0.5 * std::sin(2.0 * std::numbers::pi * hz * i / sampleRate));
+            bandLimited[static_cast<size_t>(i)] = divider.processSample(x);
+
+            const bool state = x > trigger ? true : (x < -trigger ? false : comparator);
+            flipFlop = flipFlop != (state && !comparator);
+            comparator = state;
+
+            const float square = flipFlop ? 1.0f : -1.0f;
+            const float smoothed = b0 * square + smoothing;
+            smoothing = b0 * square - a1 * smoothed;
+            naive[static_cast<size_t>(i)] = smoothed;
+        }
+
+        const juce::String label = "octave divider " + juce::String(hz, 0) + "Hz";
+        const double naiveDb = inharmonicDb(naive, hz / 2.0);
+        const double bandLimitedDb = inharmonicDb(bandLimited, hz / 2.0);
+
+        report(label + " PolyBLEP aliasing", bandLimitedDb < naiveDb - 20.0,
+               juce::String(bandLimitedDb, 1) + " dB (naive " + juce::String(naiveDb, 1) + " dB, limit naive - 20 dB)");
+
+        // The polynomial step rolls the top harmonics off slightly; the naive one adds its aliases
+        expectNear(label + " PolyBLEP vs naive level (dB)",
+                   20.0 * std::log10(rms(bandLimited) / rms(naive)), 0.0, 0.25);
+    }
+
+    //==============================================================================
+    void testRealFFT(int order)
+    {
+        const RealFFT fft(order);
+        const int size = fft.getSize();
+        const auto bins = static_cast<size_t>(fft.getNumBins());
+
+        juce::Random random(order);
+        std::vector<float> input(static_cast<size_t>(size)), scratch(input.size()), output(input.size());
+        std::vector<float> real(bins), imag(bins);
+
+        for (auto& sample : input)
+            sample = random.nextFloat() * 2.0f - 1.0f;
+
+        fft.forward(input.data(), real.data(), imag.data(), scratch.data());
+
+        // Direct DFT in double, real and imaginary parts one after the other
+        std::vector<float> expected(2 * bins), spectrum(2 * bins);
+
+        for (size_t k = 0; k < bins; ++k)
+        {
+            double re = 0.0, im = 0.0;
+
+            for (int n = 0; n < size; ++n)
+            {
+                const double angle = 2.0 * std::numbers::pi * static_cast<double>(k) * n / size;
+                re += input[static_cast<size_t>(n)] * std::cos(angle);
+                im -= input[static_cast<size_t>(n)] * std::sin(angle);
+            }
+
+            expected[k] = static_cast<float>(re);
+            expected[bins + k] = static_cast<float>(im);
+            spectrum[k] = real[k];
+            spectrum[bins + k] = imag[k];
+        }
+
+        expectNull("real fft " + juce::String(size) + " vs dft", expected, spectrum, -120.0);
+
+        // The inverse is unnormalized: size / 2 times the input
+        fft.inverse(real.data(), imag.data(), output.data(), scratch.data());
+
+        for (auto& sample : output)
+            sample *= 2.0f / static_cast<float>(size);
+
+        expectNull("real fft " + juce::String(size) + " round trip", input, output, -120.0);
+    }
+
+    /**
+     * Odd call sizes against direct convolution with the conformed taps
+     */
+    void testPartitionedConvolver(const GoldenSignal& signal, int irLength)
+    {
+        // Decaying noise that ends well above the trim threshold, so only the gain changes
+        juce::Random random(irLength);
+        std::vector<float> ir(static_cast<size_t>(irLength));
+
+        for (int t = 0; t < irLength; ++t)
+            ir[static_cast<size_t>(t)] = (random.nextFloat() * 2.0f - 1.0f) * std::exp(-3.0f * t / irLength);
+
+        ir.back() = 0.25f;
+        ir.front() = 1.0f;
+
+        const auto impulse = std::make_shared<const CabinetImpulse>(ir.data(), irLength, sampleRate, sampleRate);
+        const juce::String label = "convolver " + juce::String(irLength) + " taps";
+
+        // The conformed taps: the impulse response of the convolver itself
+        PartitionedConvolver probe;
+        probe.prepare(impulse);
+
+        std::vector<float> taps(static_cast<size_t>(irLength) + 200, 0.0f);
+        taps.front() = 1.0f;
+        probe.process(taps.data(), static_cast<int>(taps.size()));
+
+        std::vector<float> scaled(taps.size(), 0.0f);
+        for (size_t t = 0; t < ir.size(); ++t)
+            scaled[t] = ir[t] * taps.front();
+
+        expectNull(label + " impulse response", scaled, taps, -110.0);
+
+        // A few thousand samples are enough to cycle the frequency-domain delay line
+        const auto length = static_cast<size_t>(juce::jmin(24000, static_cast<int>(signal.left.size())));
+        std::vector<float> input(signal.left.begin(), signal.left.begin() + static_cast<std::ptrdiff_t>(length));
+        std::vector<float> expected(length), output(input);
+
+        for (size_t n = 0; n < length; ++n)
+        {
+            double sum = 0.0;
+            for (size_t t = 0; t < ir.size() && t <= n; ++t)
+                sum += static_cast<double>(scaled[t]) * input[n - t];
+
+            expected[n] = static_cast<float>(sum);
+        }
+
+        PartitionedConvolver convolver;
+        convolver.prepare(impulse);
+
+        const int total = static_cast<int>(length);
+        for (int start = 0, block = 1; start < total; start += block, block = block * 5 % 251 + 1)
+        {
+            block = juce::jmin(block, total - start);
+            convolver.process(output.data() + start, block);
+        }
+
+        expectNull(label + " vs direct " + signal.name, expected, output, -100.0);
+    }
+
+    /**
+     * A sine resampled to another rate against the same sine generated there
+     */
+    void testCabinetResampler(double sourceRate, double targetRate)
+    {
+        constexpr double hz = 1000.0;
+        const int sourceLength = static_cast<int>(sourceRate / 4);
+
+        std::vector<float> source(static_cast<size_t>(sourceLength));
+        for (int n = 0; n < sourceLength; ++n)
+            source[static_cast<size_t>(n)] = static_cast<float>(0.5 * std::sin(2.0 * std::numbers::pi * hz * n / sourceRate));
+
+        const auto resampled = CabinetImpulse::resample(source.data(), sourceLength, sourceRate, targetRate);
+
+        // Away from the edges, where the kernel runs off the signal
+        const auto margin = static_cast<size_t>(targetRate / 100);
+        std::vector<float> expected, output;
+
+        for (size_t n = margin; n + margin < resampled.size(); ++n)
+        {
+            expected.push_back(static_cast<float>(0.5 * std::sin(2.0 * std::numbers::pi * hz * static_cast<double>(n) / targetRate)));
+            output.push_back(resampled[n]);
+        }
+
+        expectNear("cabinet resampler " + juce::String(sourceRate / 1000.0, 1) + "k -> "
+                       + juce::String(targetRate / 1000.0, 1) + "k length",
+                   static_cast<double>(resampled.size()), std::ceil(sourceLength * targetRate / sourceRate), 0.0);
+        expectNull("cabinet resampler " + juce::String(sourceRate / 1000.0, 1) + "k -> "
+                       + juce::String(targetRate / 1000.0, 1) + "k sine",
+                   expected, output, -80.0);
+    }
+
+    //==============================================================================
+    /**
+     * True peak via 16x windowed-sinc interpolation in double (reference meter)
+     */
+    double measureTruePeak(const std::vector<float>& data, int start)
+    {
+        constexpr int factor = 16;
+        constexpr int halfTaps = 64;
+
+        double peak = 0.0;
+
+        for (int i = start + halfTaps; i < static_cast<int>(data.size()) - halfTaps; ++i)
+        {
+            for (int phase = 0; phase < factor; ++phase)
+            {
+                const double offset = static_cast<double>(phase) / factor;
+                double value = 0.0;
+
+                for (int tap = -halfTaps + 1; tap <= halfTaps; ++tap)
+                {
+                    const double t = offset - tap;
+                    const double sinc = std::abs(t) < 1.0e-9 ? 1.0 : std::sin(juce::MathConstants<double>::pi * t) / (juce::MathConstants<double>::pi * t);
+                    const double window = 0.5 + 0.5 * std::cos(juce::MathConstants<double>::pi * t / (halfTaps + 1));
+                    value += data[static_cast<size_t>(i + tap)] * sinc * window;
+                }
+
+                peak = juce::jmax(peak, std::abs(value));
+            }
+        }
+
+        return peak;
+    }
+
+    std::array<std::vector<float>, 2> runLimiter(const GoldenSignal& signal, float gain, float ceilingDb, int& latency)
+    {
+        TruePeakLimiter limiter;
+        limiter.prepare(sampleRate);
+        limiter.setCeiling(ceilingDb);
+        latency = limiter.getLatencySamples();
+
+        std::array<std::vector<float>, 2> output { signal.left, signal.right };
+        for (auto& channel : output)
+            for (auto& sample : channel)
+                sample *= gain;
+
+        // Odd host blocks exercise the internal chunking
+        float* channels[2];
+        const int length = static_cast<int>(output[0].size());
+
+        for (int start = 0, block = 1; start < length; start += block, block = block * 3 % 1021 + 1)
+        {
+            block = juce::jmin(block, length - start);
+            channels[0] = output[0].data() + start;
+            channels[1] = output[1].data() + start;
+            limiter.process(channels, 2, block);
+        }
+
+        return output;
+    }
+
+    /**
+     * @param checkTruePeak Also drive it into the ceiling and meter the result
+     *                      (signals without hard edges; the 4x detector is not
+     *                      meant to bound the overshoot of a naive saw or step)
+     */
+    void testLimiter(const GoldenSignal& signal, bool checkTruePeak)
+    {
+        constexpr float ceilingDb = -1.0f;
+        int latency = 0;
+
+        // Below the ceiling the limiter is a pure delay
+        {
+            const float gain = 0.05f;
+            const auto output = runLimiter(signal, gain, ceilingDb, latency);
+
+            for (size_t channel = 0; channel < 2; ++channel)
+            {
+                const auto& input = channel == 0 ? signal.left : signal.right;
+                std::vector<float> expected(input.size(), 0.0f);
+
+                for (size_t i = static_cast<size_t>(latency); i < input.size(); ++i)
+                    expected[i] = input[i - static_cast<size_t>(latency)] * gain;
+
+                expectNull(juce::String("limiter ") + signal.name + " transparent ch" + juce::String(static_cast<int>(channel)),
+                           expected, output[channel], -120.0);
+            }
+        }
+
+        if (!checkTruePeak)
+            return;
+
+        // Driven into the ceiling: true peaks stay at the ceiling (4x detector tolerance)
+        {
+            const auto output = runLimiter(signal, 16.0f, ceilingDb, latency);
+            const int settle = static_cast<int>(sampleRate * 0.01);
+
+            for (size_t channel = 0; channel < 2; ++channel)
+            {
+                expectFinite(juce::String("limiter ") + signal.name + " driven finite", output[channel]);
+
+                const double peakDb = 20.0 * std::log10(juce::jmax(measureTruePeak(output[channel], settle), 1.0e-10));
+                report(juce::String("limiter ") + signal.name + " true peak ch" + juce::String(static_cast<int>(channel)),
+                       peakDb <= ceilingDb + 0.3, juce::String(peakDb, 2) + " dBTP (ceiling " + juce::String(ceilingDb, 1) + ")");
+            }
+        }
+    }
+
+    /**
+     * Worst case for sample-peak detection: fs/4 with peaks halfway between samples
+     */
+    GoldenSignal makeQuarterRateSine(int length)
+    {
+        GoldenSignal signal { "fs/4-sine", std::vector<float>(static_cast<size_t>(length)), std::vector<float>(static_cast<size_t>(length)) };
+
+        for (int i = 0; i < length; ++i)
+        {
+            const double fadeIn = juce::jmin(1.0, i / (0.01 * sampleRate));
+            const double phase = juce::MathConstants<double>::halfPi * i + juce::MathConstants<double>::pi / 4.0;
+            signal.left[static_cast<size_t>(i)] = signal.right[static_cast<size_t>(i)] = static_cast<float>(0.1 * fadeIn * std::sin(phase));
+        }
+
+        return signal;
+    }
+}
+
+//==============================================================================
+void runKernelTests()
+{
+    std::printf("\nKernel equivalence (optimized vs scalar reference)\n");
+
+    testSimdVector<4>("simd x4");
+    testSimdVector<8>("simd x8");
+
+    const auto signals = makeGoldenSignals(sampleRate, numSamples);
+
+    for (const auto& signal : signals)
+        testCrossover(signal);
+
+    for (const auto& signal : signals)
+        for (const auto mode : { EnvelopeFollower::DetectorMode::PEAK, EnvelopeFollower::DetectorMode::RMS })
+            for (const int blockSize : { 32, 37 })
+                testEnvelopeFollower(signal, mode, blockSize);
+
+    testSharedTables();
+    testFilterResponse();
+
+    testLadderSmallSignal();
+
+    for (const auto& signal : signals)
+        testLadder(signal);
+
+    for (const int order : { 7, 11 })
+        testRealFFT(order);
+
+    for (const double hz : { 220.0, 1700.0, 4100.0 })
+        testOctaveDividerAliasing(hz);
+
+    for (const int irLength : { 1, 64, 65, 1000, 4800 })
+        testPartitionedConvolver(signals.front(), irLength);
+
+    testPartitionedConvolver(signals[3], 4800);
+
+    testCabinetResampler(44100.0, 96000.0);
+    testCabinetResampler(96000.0, 48000.0);
+
+    // The true-peak reference is slow: a short excerpt per signal
+    constexpr int limiterLength = 12000;
+
+    for (const auto& signal : signals)
+    {
+        const juce::String name(signal.name);
+        if (name == "silence")
+            continue;
+
+        GoldenSignal excerpt { signal.name,
+                               { signal.left.begin(), signal.left.begin() + limiterLength },
+                               { signal.right.begin(), signal.right.begin() + limiterLength } };
+        testLimiter(excerpt, name == "sweep" || name == "hot-sine");
+    }
+
+    testLimiter(makeQuarterRateSine(limiterLength), true);
+}
@@ -0,0 +1,88 @@
+#include <juce_events/juce_events.h>
+#include <cstdio>
+#include <cstring>
+#include "NullTestUtils.h"
+#include "Profiling/StageTrace.h"
+#include "Threading/AudioThreadGuard.h"
+
+/**
+ * ReeseNullTests - Kernel equivalence and null tests
+ *
+ * Usage: ReeseNullTests [kernels] [processor] [--golden DIR] [--record-golden DIR] [--trace FILE]
+ * With no suite names every suite runs. Exits nonzero if any check fails.
+ * Build with -DREESE_BUILD_TESTS=ON; runs under ctest. Add
+ * -DREESE_AUDIO_THREAD_GUARD=ON to also fail on audio-thread allocations/locks,
+ * or -DREESE_STAGE_TRACE=ON to dump the renders' stage timings with --trace.
+ */
+
+void runKernelTests();
+void runProcessorTests(const juce::File& recordDirectory, const juce::File& goldenDirectory);
+
+namespace
+{
+    juce::File recordDirectory;
+    juce::File goldenDirectory;
+    juce::File traceFile;
+
+    void runProcessorSuite()
+    {
+        runProcessorTests(recordDirectory, goldenDirectory);
+    }
+
+    struct TestSuite
+    {
+        const char* name;
+        void (*run)();
+    };
+
+    const TestSuite suites[] = {
+        { "kernels", runKernelTests },
+        { "processor", runProcessorSuite },
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    // Processors and APVTS expect the message manager to exist
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    std::vector<const char*> selectedNames;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "--golden") == 0 && hasValue)
+            goldenDirectory = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else if (std::strcmp(argv[i], "--record-golden") == 0 && hasValue)
+            recordDirectory = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else if (std::strcmp(argv[i], "--trace") == 0 && hasValue)
+            traceFile = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else
+            selectedNames.push_back(argv[i]);
+    }
+
+    for (const auto& suite : suites)
+    {
+        bool selected = selectedNames.empty();
+
+        for (const auto* name : selectedNames)
+            selected = selected || std::strcmp(name, suite.name) == 0;
+
+        if (selected)
+            suite.run();
+    }
+
+    // -DREESE_AUDIO_THREAD_GUARD=ON: every render above ran under the detector
+    if (AudioThreadGuard::isEnabled())
+        NullTestUtils::report("audio thread: no allocations or locks", AudioThreadGuard::getNumViolations() == 0,
+                              juce::String(AudioThreadGuard::getNumViolations()) + " calls (stack traces above)");
+
+    // -DREESE_STAGE_TRACE=ON: the offline renders above, as a Chrome trace
+    if (traceFile != juce::File())
+        NullTestUtils::report("stage trace written", StageTrace::isEnabled() && StageTrace::writeChromeTrace(traceFile),
+                              StageTrace::isEnabled() ? traceFile.getFullPathName() : "configure with -DREESE_STAGE_TRACE=ON");
+
+    std::printf("\n%d checks, %d failed\n", NullTestUtils::numChecks, NullTestUtils::numFailures);
+    return NullTestUtils::numFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+/**
+ * NullTestUtils - Residual measurement, reporting and golden input signals
+ *
+ * A check compares a candidate (optimized path) against a reference (scalar
+ * path, or the processor in its reference configuration) and passes when the
+ * residual is below the check's threshold. Every check prints one line so
+ * results can be diffed between builds; any failure makes the run fail.
+ */
+namespace NullTestUtils
+{
+    inline int numChecks = 0;
+    inline int numFailures = 0;
+
+    //==============================================================================
+    /**
+     * RMS of a signal
+     */
+    inline double rms(const std::vector<float>& data)
+    {
+        double energy = 0.0;
+        for (const float value : data)
+            energy += static_cast<double>(value) * static_cast<double>(value);
+
+        return std::sqrt(energy / static_cast<double>(juce::jmax<size_t>(1, data.size())));
+    }
+
+    /**
+     * Residual RMS in dB relative to a given level (use the input level for
+     * outputs that are legitimately near silent, e.g. a band-split band).
+     * Identical signals give -300 dB; any NaN/Inf gives +300 dB.
+     */
+    inline double residualDb(const std::vector<float>& reference, const std::vector<float>& candidate, double levelRms)
+    {
+        jassert(reference.size() == candidate.size());
+        const auto size = juce::jmin(reference.size(), candidate.size());
+
+        double residualEnergy = 0.0;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (!std::isfinite(reference[i]) || !std::isfinite(candidate[i]))
+                return 300.0;
+
+            const double difference = static_cast<double>(candidate[i]) - static_cast<double>(reference[i]);
+            residualEnergy += difference * difference;
+        }
+
+        if (residualEnergy == 0.0)
+            return -300.0;
+
+        const double residualRms = std::sqrt(residualEnergy / static_cast<double>(juce::jmax<size_t>(1, size)));
+        return 20.0 * std::log10(residualRms / juce::jmax(levelRms, 1.0e-6));
+    }
+
+    /**
+     * Residual RMS relative to the reference RMS in dB (dBFS if the reference is silent)
+     */
+    inline double residualDb(const std::vector<float>& reference, const std::vector<float>& candidate)
+    {
+        return residualDb(reference, candidate, rms(reference));
+    }
+
+    inline bool allFinite(const std::vector<float>& data)
+    {
+        for (const float value : data)
+            if (!std::isfinite(value))
+                return false;
+
+        return true;
+    }
+
+    //==============================================================================
+    inline bool report(const juce::String& name, bool passed, const juce::String& detail)
+    {
+        ++numChecks;
+
+        if (!passed)
+            ++numFailures;
+
+        std::printf("  %-4s %-52s %s\n", passed ? "ok" : "FAIL", name.toRawUTF8(), detail.toRawUTF8());
+        return passed;
+    }
+
+    /**
+     * Pass if the residual is below the threshold (and everything is finite)
+     */
+    inline bool expectResidual(const juce::String& name, double residual, double thresholdDb)
+    {
+        return report(name, residual < thresholdDb,
+                      juce::String(residual, 1) + " dB (limit " + juce::String(thresholdDb, 0) + " dB)");
+    }
+
+    inline bool expectNull(const juce::String& name, const std::vector<float>& reference,
+                           const std::vector<float>& candidate, double thresholdDb)
+    {
+        return expectResidual(name, residualDb(reference, candidate), thresholdDb);
+    }
+
+    /**
+     * Pass if |value - expected| <= tolerance
+     */
+    inline bool expectNear(const juce::String& name, double value, double expected, double tolerance)
+    {
+        return report(name, std::abs(value - expected) <= tolerance,
+                      juce::String(value, 3) + " (expected " + juce::String(expected, 3)
+                          + " +/- " + juce::String(tolerance, 3) + ")");
+    }
+
+    inline bool expectFinite(const juce::String& name, const std::vector<float>& data)
+    {
+        return report(name, allFinite(data), "NaN/Inf check");
+    }
+
+    //==============================================================================
+    /**
+     * Deterministic stereo test input
+     */
+    struct GoldenSignal
+    {
+        const char* name;
+        std::vector<float> left;
+        std::vector<float> right;
+    };
+
+    /**
+     * Bass material, a sweep, transients, noise, silence and an over-hot sine
+     */
+    inline std::vector<GoldenSignal> makeGoldenSignals(double sampleRate, int numSamples)
+    {
+        const auto size = static_cast<size_t>(numSamples);
+        const double twoPi = juce::MathConstants<double>::twoPi;
+
+        std::vector<GoldenSignal> signals;
+
+        // Naive sawtooth bass, right channel slightly detuned (-6 dBFS)
+        {
+            GoldenSignal signal { "bass-saw", std::vector<float>(size), std::vector<float>(size) };
+            for (size_t i = 0; i < size; ++i)
+            {
+                const double t = static_cast<double>(i) / sampleRate;
+                signal.left[i] = static_cast<float>(0.5 * (2.0 * std::fmod(55.0 * t, 1.0) - 1.0));
+                signal.right[i] = static_cast<float>(0.5 * (2.0 * std::fmod(55.3 * t, 1.0) - 1.0));
+            }
+            signals.push_back(std::move(signal));
+        }
+
+        // Exponential sine sweep 20Hz-20kHz (-12 dBFS)
+        {
+            GoldenSignal signal { "sweep", std::vector<float>(size), std::vector<float>(size) };
+            const double duration = static_cast<double>(numSamples) / sampleRate;
+            const double ratio = std::log(juce::jmin(20000.0, sampleRate * 0.45) / 20.0);
+            for (size_t i = 0; i < size; ++i)
+            {
+                const double t = static_cast<double>(i) / sampleRate;
+                const double phase = twoPi * 20.0 * duration / ratio * (std::exp(t * ratio / duration) - 1.0);
+                signal.left[i] = signal.right[i] = static_cast<float>(0.25 * std::sin(phase));
+            }
+            signals.push_back(std::move(signal));
+        }
+
+        // Full-scale impulses every 250ms
+        {
+            GoldenSignal signal { "impulses", std::vector<float>(size), std::vector<float>(size) };
+            const auto spacing = static_cast<size_t>(sampleRate * 0.25);
+            for (size_t i = 0; i < size; i += spacing)
+                signal.left[i] = signal.right[i] = 1.0f;
+            signals.push_back(std::move(signal));
+        }
+
+        // Seeded white noise (-12 dBFS peak)
+        {
+            GoldenSignal signal { "noise", std::vector<float>(size), std::vector<float>(size) };
+            juce::Random random(0x5eed);
+            for (size_t i = 0; i < size; ++i)
+            {
+                signal.left[i] = 0.25f * (2.0f * random.nextFloat() - 1.0f);
+                signal.right[i] = 0.25f * (2.0f * random.nextFloat() - 1.0f);
+            }
+            signals.push_back(std::move(signal));
+        }
+
+        // Silence (denormals, noise floor)
+        signals.push_back({ "silence", std::vector<float>(size), std::vector<float>(size) });
+
+        // 41Hz sine at +6 dBFS (overs, saturation, limiter)
+        {
+            GoldenSignal signal { "hot-sine", std::vector<float>(size), std::vector<float>(size) };
+            for (size_t i = 0; i < size; ++i)
+                signal.left[i] = signal.right[i] = static_cast<float>(2.0 * std::sin(twoPi * 41.0 * static_cast<double>(i) / sampleRate));
+            signals.push_back(std::move(signal));
+        }
+
+        return signals;
+    }
+}
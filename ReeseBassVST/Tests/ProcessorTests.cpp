@@ -0,0 +1,1089 @@
+#include "NullTestUtils.h"
+#include "PluginProcessor.h"
+#include "DSP/BatchedReeseEngine.h"
+#include <cstring>
+
+/**
+ * ProcessorTests - Full processor on the golden inputs
+ *
+ * - Every golden signal through every preset must stay finite.
+ * - Configurations that only change how the work is scheduled (Multi-Core,
+ *   prepared block size) must null exactly against the serial reference.
+ * - Offline "Same as Live" must null against live, and the oversampled
+ *   profile must keep the same level.
+ * - A routing to any destination the modulation matrix offers must change
+ *   the output.
+ * - A cabinet IR that is a unit impulse or a pure delay must null against
+ *   the plain (or delayed) render.
+ * - A preset file read by PresetService and swapped in at the next block
+ *   must null against setting its parameters between the same two blocks.
+ * - ParameterHistory must undo and redo gestures and presets as whole steps,
+ *   ignore changes without a gesture, and stay within its capacity.
+ * - Host state must restore every parameter from the binary format, and
+ *   table defaults for rows a shorter blob or a legacy XML state lacks.
+ * - Automating the limiter lookahead must not drop out, and the host must
+ *   hear about the new latency once it settles.
+ * - BatchedReeseEngine lanes must match the processor's channels in the
+ *   configurations it models (vector tanh/sine: not bit-exact).
+ * - Optionally, renders are compared against golden files recorded from a
+ *   known-good build (--record-golden / --golden).
+ *
+ * Noise and ring-LFO jitter are seeded (REESE_DETERMINISTIC_NOISE), so two
+ * renders of the same configuration are bit-identical.
+ */
+namespace
+{
+    using namespace NullTestUtils;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int numSamples = 96000;
+
+    struct ParameterSetting
+    {
+        const char* id;
+        float value;    // Real units
+    };
+
+    struct Preset
+    {
+        const char* name;
+        std::vector<ParameterSetting> settings;
+    };
+
+    const std::vector<Preset>& getPresets()
+    {
+        // Destinations are modulationDestinations index + 1 (0 = none); sources follow ModulationMatrix::Source
+        static const std::vector<Preset> presets = {
+            { "default", {} },
+            { "extreme", { { "resonance", 0.95f }, { "drive", 2.0f }, { "character", 1.0f },
+                           { "ringDepth", 1.0f }, { "noiseAmount", 1.0f }, { "volume", 6.0f },
+                           { "multiband", 1.0f }, { "subCharacter", 1.0f }, { "highCharacter", 1.0f },
+                           { "mod1Source", 2.0f }, { "mod1Destination", 1.0f }, { "mod1Amount", 1.0f },
+                           { "mod2Source", 1.0f }, { "mod2Destination", 7.0f }, { "mod2Amount", 0.5f },
+                           { "mod3Source", 4.0f }, { "mod3Destination", 2.0f }, { "mod3Amount", -0.5f },
+                           { "limiterMode", 1.0f } } },
+        };
+
+        return presets;
+    }
+
+    struct RenderOptions
+    {
+        int hostBlockSize = 512;
+        int preparedBlockSize = 512;
+        bool multiCore = false;
+        bool offline = false;
+        float offlineQuality = 2.0f;
+        bool linkedStereo = false;
+        int hostBypassStart = -1;   // Host blocks starting in [start, end) go through processBlockBypassed
+        int hostBypassEnd = -1;
+        juce::File cabinetFile;     // Loaded before prepareToPlay (which builds it)
+        int presetBlock = -1;       // Host block before which presetValues are applied
+        ParameterValues presetValues;
+        bool presetAtNextBlock = false;   // Through the processor's swap, not parameter by parameter
+        int lookaheadSweepBlocks = 0;     // Limiter Lookahead automated 0.5-5ms and back per host block, then held at 4ms
+        int* latencyReports = nullptr;    // Counts the latency changes reported while rendering
+        const GoldenSignal* sidechain = nullptr;   // Enables the sidechain bus and feeds it this signal
+    };
+
+    /**
+     * Render one golden signal, interleaved stereo output
+     */
+    std::vector<float> render(const GoldenSignal& signal, const Preset& preset, const RenderOptions& options)
+    {
+        ReeseDestroyerAudioProcessor processor;
+        auto& parameters = processor.getParameters();
+
+        auto setParameter = [&](const char* id, float value) {
+            auto* parameter = parameters.getParameter(id);
+            jassert(parameter != nullptr);
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+        };
+
+        for (const auto& setting : preset.settings)
+            setParameter(setting.id, setting.value);
+
+        setParameter("multiCore", options.multiCore ? 1.0f : 0.0f);
+        setParameter("offlineQuality", options.offlineQuality);
+        setParameter("stereoLink", options.linkedStereo ? 1.0f : 0.0f);
+
+        if (options.cabinetFile != juce::File())
+            processor.getCabinetLoader().load(options.cabinetFile);
+
+        processor.setNonRealtime(options.offline);
+        processor.setPlayConfigDetails(2, 2, sampleRate, options.preparedBlockSize);
+
+        if (options.sidechain != nullptr)
+            processor.enableAllBuses();
+
+        processor.prepareToPlay(sampleRate, options.preparedBlockSize);
+
+        // Room for the sidechain bus if the layout enables it (silent unless options.sidechain)
+        const int numBufferChannels = juce::jmax(2, processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+        juce::AudioBuffer<float> buffer(numBufferChannels, options.hostBlockSize);
+        juce::MidiBuffer midi;
+
+        const int length = static_cast<int>(signal.left.size());
+        std::vector<float> output(static_cast<size_t>(length) * 2);
+
+        for (int start = 0; start < length; start += options.hostBlockSize)
+        {
+            const int n = juce::jmin(options.hostBlockSize, length - start);
+            buffer.setSize(numBufferChannels, n, false, false, true);
+            buffer.clear();
+            buffer.copyFrom(0, 0, signal.left.data() + start, n);
+            buffer.copyFrom(1, 0, signal.right.data() + start, n);
+
+            if (options.sidechain != nullptr && numBufferChannels >= 4)
+            {
+                buffer.copyFrom(2, 0, options.sidechain->left.data() + start, n);
+                buffer.copyFrom(3, 0, options.sidechain->right.data() + start, n);
+            }
+
+            if (start / options.hostBlockSize == options.presetBlock)
+            {
+                if (options.presetAtNextBlock)
+                    processor.applyPresetAtNextBlock(options.presetValues);
+                else
+                    for (const auto& descriptor : parameterTable)
+                        if (ParameterTable::isPresetParameter(descriptor))
+                            setParameter(descriptor.id, options.presetValues[descriptor.paramID]);
+            }
+
+            if (options.lookaheadSweepBlocks > 0)
+            {
+                const int block = start / options.hostBlockSize;
+                const float phase = static_cast<float>(block % 32) / 16.0f;
+                setParameter("limiterLookahead", block < options.lookaheadSweepBlocks
+                                                     ? 0.5f + 4.5f * (phase < 1.0f ? phase : 2.0f - phase)
+                                                     : 4.0f);
+            }
+
+            const int latency = processor.getLatencySamples();
+
+            if (start >= options.hostBypassStart && start < options.hostBypassEnd)
+                processor.processBlockBypassed(buffer, midi);
+            else
+                processor.processBlock(buffer, midi);
+
+            if (options.latencyReports != nullptr && processor.getLatencySamples() != latency)
+                ++*options.latencyReports;
+
+            for (int i = 0; i < n; ++i)
+            {
+                output[static_cast<size_t>(start + i) * 2] = buffer.getSample(0, i);
+                output[static_cast<size_t>(start + i) * 2 + 1] = buffer.getSample(1, i);
+            }
+        }
+
+        processor.releaseResources();
+        return output;
+    }
+
+    double rmsDb(const std::vector<float>& data)
+    {
+        return 20.0 * std::log10(juce::jmax(rms(data), 1.0e-15));
+    }
+
+    //==============================================================================
+    void testFinite(const std::vector<GoldenSignal>& signals)
+    {
+        for (const auto& preset : getPresets())
+        {
+            for (const auto& signal : signals)
+            {
+                expectFinite(juce::String(preset.name) + " " + signal.name + " live", render(signal, preset, {}));
+
+                RenderOptions offline;
+                offline.offline = true;
+                offline.offlineQuality = 3.0f;
+                expectFinite(juce::String(preset.name) + " " + signal.name + " offline 8x", render(signal, preset, offline));
+            }
+        }
+    }
+
+    void testSchedulingNulls(const std::vector<GoldenSignal>& signals)
+    {
+        for (const auto& preset : getPresets())
+        {
+            for (const auto& signal : signals)
+            {
+                const juce::String prefix = juce::String(preset.name) + " " + signal.name;
+                const auto reference = render(signal, preset, {});
+
+                RenderOptions multiCore;
+                multiCore.multiCore = true;
+                expectNull(prefix + " multi-core vs serial", reference, render(signal, preset, multiCore), -200.0);
+
+                // Host blocks longer than prepared: split into sub-blocks
+                RenderOptions split;
+                split.preparedBlockSize = 64;
+                expectNull(prefix + " prepared 64 vs 512", reference, render(signal, preset, split), -200.0);
+
+                // Short, odd host blocks continue the control-block grid instead of restarting it.
+                // Exact while no routing reads the audio detectors (their envelope splits with the block)
+                if (juce::String(preset.name) == "default")
+                {
+                    RenderOptions shortBlocks;
+                    shortBlocks.hostBlockSize = 37;
+                    expectNull(prefix + " host blocks 37 vs 512", reference, render(signal, preset, shortBlocks), -200.0);
+                }
+
+                RenderOptions offlineSplit;
+                offlineSplit.offline = true;
+                offlineSplit.offlineQuality = 1.0f;
+                RenderOptions offlineSplitSmall = offlineSplit;
+                offlineSplitSmall.preparedBlockSize = 64;
+                expectNull(prefix + " offline 2x prepared 64 vs 512",
+                           render(signal, preset, offlineSplit), render(signal, preset, offlineSplitSmall), -200.0);
+            }
+        }
+    }
+
+    void testProfiles(const std::vector<GoldenSignal>& signals)
+    {
+        const auto& preset = getPresets().front();
+
+        for (const auto& signal : signals)
+        {
+            const auto live = render(signal, preset, {});
+
+            // "Same as Live" renders through the live profile
+            RenderOptions sameAsLive;
+            sameAsLive.offline = true;
+            sameAsLive.offlineQuality = 0.0f;
+            expectNull(juce::String("offline same-as-live vs live ") + signal.name,
+                       live, render(signal, preset, sameAsLive), -200.0);
+
+            // Oversampling changes aliasing, not level
+            const juce::String name(signal.name);
+            if (name == "bass-saw" || name == "sweep")
+            {
+                RenderOptions oversampled;
+                oversampled.offline = true;
+                oversampled.offlineQuality = 2.0f;
+                expectNear("offline 4x vs live level " + name + " (dB)",
+                           rmsDb(render(signal, preset, oversampled)) - rmsDb(live), 0.0, 1.0);
+            }
+        }
+    }
+
+    /**
+     * Dual-mono sharing and Linked Stereo
+     */
+    void testStereoSharing(const std::vector<GoldenSignal>& signals)
+    {
+        const auto& preset = getPresets().front();
+        const Preset zeroWidth { "zero-width", { { "stereoWidth", 0.0f } } };
+
+        for (const auto& signal : signals)
+        {
+            const juce::String name(signal.name);
+            const auto half = static_cast<std::ptrdiff_t>(signal.left.size() / 2);
+
+            // Stereo for the first half, then the left channel on both: sharing starts
+            // and stops mid-render, which must not depend on the thread split
+            GoldenSignal switching { signal.name, signal.left, signal.right };
+            std::copy(signal.left.begin() + half, signal.left.end(), switching.right.begin() + half);
+
+            RenderOptions multiCore;
+            multiCore.multiCore = true;
+            expectNull(name + " stereo then dual mono, multi-core vs serial",
+                       render(switching, preset, {}), render(switching, preset, multiCore), -200.0);
+
+            // Dual mono at zero width: the right chain (same settings, and the same seeds
+            // in test builds) must produce the left output from the shared octave path
+            const GoldenSignal dualMono { signal.name, signal.left, signal.left };
+            const auto output = render(dualMono, zeroWidth, {});
+
+            std::vector<float> left(signal.left.size()), right(signal.left.size());
+            for (size_t i = 0; i < left.size(); ++i)
+            {
+                left[i] = output[i * 2];
+                right[i] = output[i * 2 + 1];
+            }
+
+            expectNull(name + " dual mono zero width, right vs left", left, right, -200.0);
+
+            // Linked Stereo: one filtered mid, each channel's ring LFO applied afterwards
+            RenderOptions linked;
+            linked.linkedStereo = true;
+            const auto linkedOutput = render(signal, preset, linked);
+            expectFinite(name + " linked stereo", linkedOutput);
+
+            if (name == "bass-saw" || name == "sweep")
+                expectNear("linked vs unlinked level " + name + " (dB)",
+                           rmsDb(linkedOutput) - rmsDb(render(signal, preset, {})), 0.0, 1.0);
+        }
+    }
+
+    void testLadderModel(const std::vector<GoldenSignal>& signals)
+    {
+        // Separate from getPresets(), so golden directories recorded before the ladder still match
+        const Preset ladder { "ladder", { { "filterModel", 1.0f }, { "resonance", 0.95f }, { "drive", 2.0f },
+                                          { "character", 1.0f }, { "volume", 6.0f } } };
+
+        for (const auto& signal : signals)
+        {
+            expectFinite(juce::String(ladder.name) + " " + signal.name + " live", render(signal, ladder, {}));
+
+            RenderOptions offline;
+            offline.offline = true;
+            offline.offlineQuality = 3.0f;
+            expectFinite(juce::String(ladder.name) + " " + signal.name + " offline 8x", render(signal, ladder, offline));
+        }
+    }
+
+    /**
+     * Every destination the matrix offers must be audible when a routing targets it
+     */
+    void testModulationDestinations(const std::vector<GoldenSignal>& signals)
+    {
+        const auto find = [&](const char* name) -> const GoldenSignal& {
+            for (const auto& signal : signals)
+                if (juce::String(signal.name) == name)
+                    return signal;
+
+            jassertfalse;
+            return signals.front();
+        };
+
+        // Multiband on and ducking from a transient sidechain, so the band and sidechain rows are in the signal path
+        const std::vector<ParameterSetting> base { { "multiband", 1.0f }, { "subCharacter", 0.5f },
+                                                   { "duckCutoff", 0.5f }, { "duckRingDepth", 0.5f },
+                                                   { "duckDrive", 0.5f }, { "lfo1Rate", 4.0f } };
+
+        const auto& signal = find("bass-saw");
+        RenderOptions options;
+        options.sidechain = &find("impulses");
+
+        const auto unmodulated = render(signal, { "unmodulated", base }, options);
+
+        for (int destination = 1; destination <= numModulationDestinations; ++destination)
+        {
+            auto settings = base;
+            settings.push_back({ "mod1Source", 2.0f });   // LFO 1
+            settings.push_back({ "mod1Destination", static_cast<float>(destination) });
+            settings.push_back({ "mod1Amount", 1.0f });
+
+            const auto id = modulationDestinations[static_cast<size_t>(destination - 1)];
+            const double residual = residualDb(unmodulated, render(signal, { "modulated", settings }, options));
+
+            report(juce::String("LFO 1 -> ") + ParameterTable::get(id).name + " changes the output",
+                   residual > -60.0, juce::String(residual, 1) + " dB (needs > -60 dB)");
+        }
+    }
+
+    /**
+     * Input interleaved like render(), delayed by a number of samples
+     */
+    std::vector<float> delayedInput(const GoldenSignal& signal, int delay)
+    {
+        std::vector<float> output(signal.left.size() * 2, 0.0f);
+
+        for (size_t i = static_cast<size_t>(delay); i < signal.left.size(); ++i)
+        {
+            output[i * 2] = signal.left[i - static_cast<size_t>(delay)];
+            output[i * 2 + 1] = signal.right[i - static_cast<size_t>(delay)];
+        }
+
+        return output;
+    }
+
+    float largestStep(const std::vector<float>& interleaved)
+    {
+        float largest = 0.0f;
+
+        for (size_t i = 2; i < interleaved.size(); ++i)
+            largest = juce::jmax(largest, std::abs(interleaved[i] - interleaved[i - 2]));
+
+        return largest;
+    }
+
+    void testBypass(const std::vector<GoldenSignal>& signals)
+    {
+        const auto& preset = getPresets().front();
+        const Preset bypassed { "bypassed", { { "bypass", 1.0f } } };
+        const Preset bypassedLimiter { "bypassed-limiter", { { "bypass", 1.0f }, { "limiterMode", 1.0f } } };
+
+        // The true-peak limiter's latency at its default lookahead
+        int limiterLatency = 0;
+        {
+            ReeseDestroyerAudioProcessor processor;
+            auto* parameter = processor.getParameters().getParameter("limiterMode");
+            parameter->setValueNotifyingHost(1.0f);
+            processor.setPlayConfigDetails(2, 2, sampleRate, 512);
+            processor.prepareToPlay(sampleRate, 512);
+            limiterLatency = processor.getLatencySamples();
+        }
+
+        // Host bypass over the middle third; the 20ms fade-out ends within two blocks
+        RenderOptions hostBypass;
+        hostBypass.hostBypassStart = numSamples / 3;
+        hostBypass.hostBypassEnd = numSamples * 2 / 3;
+
+        const int firstBypassedBlock = (hostBypass.hostBypassStart + 511) / 512 * 512;
+        const auto faded = static_cast<std::ptrdiff_t>(firstBypassedBlock + 1024) * 2;
+        const auto released = static_cast<std::ptrdiff_t>(hostBypass.hostBypassEnd) * 2;
+
+        for (const auto& signal : signals)
+        {
+            const juce::String name(signal.name);
+
+            expectNull(name + " bypassed, output vs input",
+                       delayedInput(signal, 0), render(signal, bypassed, {}), -200.0);
+            expectNull(name + " bypassed true-peak, output vs input delayed by the latency",
+                       delayedInput(signal, limiterLatency), render(signal, bypassedLimiter, {}), -200.0);
+
+            // Faded out: the input passes untouched. Fading in after the chains restart
+            // must not step further than the processed or dry signal does on its own
+            const auto reference = render(signal, preset, {});
+            const auto output = render(signal, preset, hostBypass);
+            const auto input = delayedInput(signal, 0);
+
+            expectFinite(name + " host bypass", output);
+            expectNull(name + " host bypass, faded-out part vs input",
+                       std::vector<float>(input.begin() + faded, input.begin() + released),
+                       std::vector<float>(output.begin() + faded, output.begin() + released), -200.0);
+
+            const float step = largestStep(output);
+            const float bound = 1.5f * juce::jmax(largestStep(reference), largestStep(input));
+            report(name + " host bypass, no click", step <= bound,
+                   juce::String(step, 4) + " (limit " + juce::String(bound, 4) + ")");
+        }
+    }
+
+    //==============================================================================
+    /**
+     * Write a mono 32-bit float WAV (the cabinet tests' IR files)
+     */
+    bool writeImpulseFile(const juce::File& file, const std::vector<float>& samples, double rate)
+    {
+        file.deleteFile();
+
+        auto stream = std::make_unique<juce::FileOutputStream>(file);
+        if (!stream->openedOk())
+            return false;
+
+        juce::WavAudioFormat format;
+        std::unique_ptr<juce::AudioFormatWriter> writer(format.createWriterFor(stream.get(), rate, 1, 32, {}, 0));
+        if (writer == nullptr)
+            return false;
+
+        stream.release();   // Owned by the writer
+
+        const float* channels[] = { samples.data() };
+        return writer->writeFromFloatArrays(channels, 1, static_cast<int>(samples.size()));
+    }
+
+    /**
+     * Render output delayed by a number of frames (interleaved stereo)
+     */
+    std::vector<float> delayedOutput(const std::vector<float>& interleaved, int delay)
+    {
+        std::vector<float> output(interleaved.size(), 0.0f);
+        const auto offset = static_cast<size_t>(delay) * 2;
+
+        std::copy(interleaved.begin(), interleaved.end() - static_cast<std::ptrdiff_t>(offset), output.begin() + static_cast<std::ptrdiff_t>(offset));
+        return output;
+    }
+
+    /**
+     * Longest run of silent frames after the first 1024 (the initial latency)
+     */
+    int longestSilence(const std::vector<float>& interleaved)
+    {
+        int longest = 0;
+        int run = 0;
+
+        for (size_t i = 2048; i + 1 < interleaved.size(); i += 2)
+        {
+            run = std::abs(interleaved[i]) < 1.0e-6f && std::abs(interleaved[i + 1]) < 1.0e-6f ? run + 1 : 0;
+            longest = juce::jmax(longest, run);
+        }
+
+        return longest;
+    }
+
+    void testLimiterAutomation(const std::vector<GoldenSignal>& signals)
+    {
+        const Preset limited { "true-peak", { { "limiterMode", 1.0f } } };
+
+        // Swept over the first half, then held long enough to settle
+        RenderOptions sweep;
+        sweep.lookaheadSweepBlocks = numSamples / 2 / 512;
+
+        for (const auto& signal : signals)
+        {
+            const juce::String name(signal.name);
+            int reports = 0;
+            sweep.latencyReports = &reports;
+
+            const auto reference = render(signal, limited, {});
+            const auto output = render(signal, limited, sweep);
+
+            expectFinite(name + " lookahead automation", output);
+
+            // The limiter retunes in place: where the fixed lookahead plays without a
+            // gap, so must the automated one (no stretch of the delay line zeroed)
+            if (longestSilence(reference) == 0)
+            {
+                const int silence = longestSilence(output);
+                report(name + " lookahead automation, no dropout", silence == 0,
+                       juce::String(silence) + " silent frames");
+            }
+
+            report(name + " lookahead automation, latency reported once settled", reports == 1,
+                   juce::String(reports) + " reports");
+        }
+    }
+
+    void testCabinet(const std::vector<GoldenSignal>& signals)
+    {
+        const auto directory = juce::File::getSpecialLocation(juce::File::tempDirectory).getChildFile("ReeseCabinetTests");
+        directory.createDirectory();
+
+        // A unit impulse is the identity; a lone tap at 300 (normalized to 0dB) a delay
+        // through the FFT partitions. The output stage is memoryless, so it commutes
+        constexpr int delay = 300;
+        std::vector<float> delayed(delay + 1, 0.0f);
+        delayed.back() = 0.5f;
+
+        const auto identityFile = directory.getChildFile("identity.wav");
+        const auto delayFile = directory.getChildFile("delay.wav");
+        const auto missingFile = directory.getChildFile("missing.wav");
+        missingFile.deleteFile();
+
+        if (!report("cabinet IR files written", writeImpulseFile(identityFile, { 1.0f }, sampleRate)
+                                                    && writeImpulseFile(delayFile, delayed, sampleRate),
+                    directory.getFullPathName()))
+            return;
+
+        const auto& preset = getPresets().front();
+        const Preset cabinetOn { "cabinet", { { "cabinet", 1.0f } } };
+        const Preset cabinetHalf { "cabinet-half", { { "cabinet", 1.0f }, { "cabinetMix", 0.5f } } };
+
+        RenderOptions identity, delaying, missing;
+        identity.cabinetFile = identityFile;
+        delaying.cabinetFile = delayFile;
+        missing.cabinetFile = missingFile;
+
+        for (const auto& signal : signals)
+        {
+            const juce::String name(signal.name);
+            const auto reference = render(signal, preset, {});
+
+            expectNull(name + " cabinet unit impulse vs no cabinet", reference, render(signal, cabinetOn, identity), -200.0);
+            expectNull(name + " cabinet unit impulse at 50% mix vs no cabinet", reference, render(signal, cabinetHalf, identity), -200.0);
+            expectNull(name + " cabinet delay vs delayed output", delayedOutput(reference, delay),
+                       render(signal, cabinetOn, delaying), -100.0);
+            expectNull(name + " cabinet unreadable file vs no cabinet", reference, render(signal, cabinetOn, missing), -200.0);
+        }
+
+        // The path travels with the state; an unreadable file reports itself
+        {
+            ReeseDestroyerAudioProcessor processor;
+            processor.getCabinetLoader().load(delayFile);
+            processor.setPlayConfigDetails(2, 2, sampleRate, 512);
+            processor.prepareToPlay(sampleRate, 512);
+
+            juce::MemoryBlock state;
+            processor.getStateInformation(state);
+
+            ReeseDestroyerAudioProcessor restored;
+            restored.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+            report("cabinet path restored from state", restored.getCabinetLoader().getFile() == delayFile,
+                   restored.getCabinetLoader().getFile().getFullPathName());
+
+            processor.getCabinetLoader().load(missingFile);
+            processor.prepareToPlay(sampleRate, 512);
+            report("cabinet unreadable file status", processor.getCabinetLoader().getStatus() == CabinetLoader::Status::FAILED,
+                   missingFile.getFullPathName());
+        }
+
+        identityFile.deleteFile();
+        delayFile.deleteFile();
+    }
+
+    //==============================================================================
+    ParameterValues toParameterValues(const Preset& preset)
+    {
+        ParameterValues values;
+
+        for (const auto& setting : preset.settings)
+            for (const auto& descriptor : parameterTable)
+                if (std::strcmp(descriptor.id, setting.id) == 0)
+                    values[descriptor.paramID] = setting.value;
+
+        return values;
+    }
+
+    void testPresets(const std::vector<GoldenSignal>& signals)
+    {
+        const auto directory = juce::File::getSpecialLocation(juce::File::tempDirectory).getChildFile("ReesePresetTests");
+        directory.createDirectory();
+
+        // The extreme test preset, plus two values out of range that loading must constrain
+        ParameterManager::Preset written;
+        written.name = "Extreme";
+        written.parameters = toParameterValues(getPresets().back());
+        written.parameters[ParamID::cutoff] = 5000.0f;
+        written.parameters[ParamID::octaveBlend] = 0.333f;
+
+        const auto presetFile = directory.getChildFile("extreme.xml");
+        const auto missingFile = directory.getChildFile("missing.xml");
+        missingFile.deleteFile();
+
+        if (!report("preset file written", ParameterManager::savePresetToFile(written, presetFile), presetFile.getFullPathName()))
+            return;
+
+        const auto loaded = PresetService::readPreset(presetFile);
+
+        if (!report("preset file read", loaded.has_value() && loaded->name == written.name, presetFile.getFullPathName()))
+            return;
+
+        report("preset values constrained on load",
+               loaded->parameters[ParamID::cutoff] == 2000.0f && std::abs(loaded->parameters[ParamID::octaveBlend] - 0.33f) < 1.0e-6f,
+               "cutoff " + juce::String(loaded->parameters[ParamID::cutoff]) + ", octave blend "
+                   + juce::String(loaded->parameters[ParamID::octaveBlend]));
+        report("preset missing file", !PresetService::readPreset(missingFile).has_value(), missingFile.getFullPathName());
+
+        // A third of the way in, between two host blocks
+        RenderOptions swapped, set;
+        swapped.presetBlock = set.presetBlock = numSamples / 3 / 512;
+        swapped.presetValues = set.presetValues = loaded->parameters;
+        swapped.presetAtNextBlock = true;
+
+        const auto& preset = getPresets().front();
+
+        for (const auto& signal : signals)
+        {
+            const juce::String name(signal.name);
+            expectNull(name + " preset swapped at the next block vs set between blocks",
+                       render(signal, preset, set), render(signal, preset, swapped), -200.0);
+        }
+
+        // Bypass and the engine options are not part of a preset: not written...
+        ParameterManager::Preset engine = written;
+        engine.parameters[ParamID::bypass] = 1.0f;
+        engine.parameters[ParamID::multiCore] = 1.0f;
+        ParameterManager::savePresetToFile(engine, presetFile);
+
+        const auto xml = juce::XmlDocument::parse(presetFile);
+        const auto* stored = xml != nullptr ? xml->getChildByName("Parameters") : nullptr;
+        report("preset file leaves out bypass and engine options",
+               stored != nullptr && stored->hasAttribute("cutoff") && !stored->hasAttribute("bypass") && !stored->hasAttribute("multiCore"),
+               presetFile.getFullPathName());
+
+        // ...and loading one (bypass off in its values) leaves a bypassed instance bypassed
+        {
+            ReeseDestroyerAudioProcessor processor;
+            auto* bypass = processor.getParameters().getParameter("bypass");
+            bypass->setValueNotifyingHost(1.0f);
+            processor.setPlayConfigDetails(2, 2, sampleRate, 512);
+            processor.prepareToPlay(sampleRate, 512);
+
+            juce::AudioBuffer<float> buffer(juce::jmax(2, processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels()), 512);
+            juce::MidiBuffer midi;
+            buffer.clear();
+
+            processor.applyPresetAtNextBlock(loaded->parameters);
+            processor.processBlock(buffer, midi);
+
+            report("preset load keeps bypass on",
+                   bypass->getValue() >= 0.5f && processor.getParameters().getRawParameterValue("bypass")->load() >= 0.5f,
+                   "bypass " + juce::String(processor.getParameters().getRawParameterValue("bypass")->load()));
+            processor.releaseResources();
+        }
+
+        // The same through the render loop (limiter off, so the latency stays zero)
+        const Preset bypassed { "bypassed", { { "bypass", 1.0f } } };
+        RenderOptions whileBypassed = swapped;
+        whileBypassed.presetValues[ParamID::limiterMode] = 0.0f;
+
+        for (const auto& signal : signals)
+            expectNull(juce::String(signal.name) + " preset swapped in while bypassed, output vs input",
+                       delayedInput(signal, 0), render(signal, bypassed, whileBypassed), -200.0);
+
+        presetFile.deleteFile();
+    }
+
+    //==============================================================================
+    void testParameterHistory()
+    {
+        ReeseDestroyerAudioProcessor processor;
+        auto& history = processor.getParameterHistory();
+        auto* cutoff = processor.getParameters().getParameter("cutoff");
+        auto* resonance = processor.getParameters().getParameter("resonance");
+        auto* drive = processor.getParameters().getParameter("drive");
+
+        // A slider drag: one gesture, many values
+        const auto drag = [](juce::RangedAudioParameter* parameter, std::initializer_list<float> values) {
+            parameter->beginChangeGesture();
+            for (const float value : values)
+                parameter->setValueNotifyingHost(value);
+            parameter->endChangeGesture();
+        };
+
+        // Normalized values, after a round trip through the parameter's real-unit value
+        const auto same = [](float a, float b) { return std::abs(a - b) < 1.0e-6f; };
+
+        const float cutoffStart = cutoff->getValue();
+        const float resonanceStart = resonance->getValue();
+
+        drag(cutoff, { 0.1f, 0.2f, 0.3f });
+        drag(cutoff, { 0.4f });            // Within coalesceTime: the same step
+        const float cutoffEdited = cutoff->getValue();
+        drag(resonance, { 0.9f });
+        const float resonanceEdited = resonance->getValue();
+        drive->setValueNotifyingHost(0.25f);   // No gesture (automation): not recorded
+        const float driveAutomated = drive->getValue();
+
+        history.undo();
+        report("history undo restores the last gesture", same(resonance->getValue(), resonanceStart) && same(cutoff->getValue(), cutoffEdited),
+               "resonance " + juce::String(resonance->getValue()));
+        history.undo();
+        report("history coalesced drags undo as one step", same(cutoff->getValue(), cutoffStart) && !history.canUndo(),
+               "cutoff " + juce::String(cutoff->getValue()));
+        report("history ignores changes without a gesture", same(drive->getValue(), driveAutomated),
+               "drive " + juce::String(drive->getValue()));
+
+        history.redo();
+        history.redo();
+        report("history redo", same(cutoff->getValue(), cutoffEdited) && same(resonance->getValue(), resonanceEdited) && !history.canRedo(),
+               "cutoff " + juce::String(cutoff->getValue()) + ", resonance " + juce::String(resonance->getValue()));
+
+        // A preset is one step, however many parameters it sets
+        ParameterValues preset;
+        preset[ParamID::cutoff] = 1000.0f;
+        preset[ParamID::drive] = 2.0f;
+        history.recordChanges(preset);
+
+        for (const auto& descriptor : parameterTable)
+        {
+            auto* parameter = processor.getParameters().getParameter(descriptor.id);
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(preset[descriptor.paramID]));
+        }
+
+        history.undo();
+        report("history preset undoes as one step",
+               same(cutoff->getValue(), cutoffEdited) && same(resonance->getValue(), resonanceEdited) && same(drive->getValue(), driveAutomated),
+               "cutoff " + juce::String(cutoff->getValue()) + ", drive " + juce::String(drive->getValue()));
+
+        drag(resonance, { 0.1f });
+        report("history new edit drops redo", !history.canRedo(), {});
+
+        // Alternating parameters never coalesce: the ring keeps the newest capacity deltas
+        for (int i = 0; i < 4 * ParameterHistory::capacity; ++i)
+            drag(i % 2 == 0 ? cutoff : resonance, { static_cast<float>(i % 7) / 7.0f });
+
+        int numSteps = 0;
+        while (history.undo())
+            ++numSteps;
+
+        report("history bounded", numSteps == ParameterHistory::capacity,
+               juce::String(numSteps) + " steps, " + juce::String(static_cast<int>(sizeof(ParameterHistory))) + " bytes");
+    }
+
+    /**
+     * Configurations BatchedReeseEngine models: no modulation, full band,
+     * soft knee, and zero stereo width so both channels share parameters
+     */
+    const std::vector<Preset>& getBatchPresets()
+    {
+        static const std::vector<Preset> presets = {
+            { "batch-default", { { "stereoWidth", 0.0f } } },
+            { "batch-hot", { { "stereoWidth", 0.0f }, { "cutoff", 1500.0f }, { "resonance", 0.95f }, { "ringRate", 8.0f },
+                             { "ringDepth", 1.0f }, { "octaveBlend", 1.0f }, { "character", 1.0f }, { "drive", 2.0f },
+                             { "noiseAmount", 1.0f }, { "volume", 6.0f } } },
+            { "batch-soft", { { "stereoWidth", 0.0f }, { "cutoff", 200.0f }, { "resonance", 0.0f }, { "ringRate", 0.5f },
+                              { "ringDepth", 0.0f }, { "octaveBlend", 0.0f }, { "character", 0.0f }, { "drive", 0.3f },
+                              { "noiseAmount", 0.0f }, { "volume", -12.0f } } },
+        };
+
+        return presets;
+    }
+
+    /**
+     * A preset's values as the processor sees them (after range snapping)
+     */
+    BatchedReeseEngine::InstanceParameters getInstanceParameters(const Preset& preset)
+    {
+        ReeseDestroyerAudioProcessor processor;
+        auto& parameters = processor.getParameters();
+
+        for (const auto& setting : preset.settings)
+        {
+            auto* parameter = parameters.getParameter(setting.id);
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(setting.value));
+        }
+
+        auto value = [&](const char* id) { return parameters.getRawParameterValue(id)->load(); };
+
+        BatchedReeseEngine::InstanceParameters instance;
+        instance.cutoff = value("cutoff");
+        instance.resonance = value("resonance");
+        instance.ringRate = value("ringRate");
+        instance.ringDepth = value("ringDepth");
+        instance.octaveBlend = value("octaveBlend");
+        instance.character = value("character");
+        instance.drive = value("drive");
+        instance.noiseAmount = value("noiseAmount");
+        instance.volume = value("volume");
+        return instance;
+    }
+
+    /**
+     * Parameters (real units) that differ from expected, by name
+     */
+    juce::String stateMismatches(ReeseDestroyerAudioProcessor& processor, const ParameterValues& expected)
+    {
+        juce::StringArray names;
+
+        for (const auto& descriptor : parameterTable)
+        {
+            const float value = processor.getParameters().getRawParameterValue(descriptor.id)->load();
+            const float tolerance = 1.0e-5f * (descriptor.maxValue - descriptor.minValue);
+
+            if (std::abs(value - expected[descriptor.paramID]) > tolerance)
+                names.add(descriptor.id);
+        }
+
+        return names.joinIntoString(", ");
+    }
+
+    void testState()
+    {
+        // Source: the extreme preset. Target: every parameter somewhere else first,
+        // so nothing the restore leaves alone can pass for a restored value
+        ReeseDestroyerAudioProcessor source;
+
+        for (const auto& setting : getPresets().back().settings)
+        {
+            auto* parameter = source.getParameters().getParameter(setting.id);
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(setting.value));
+        }
+
+        ParameterValues saved;
+        for (const auto& descriptor : parameterTable)
+            saved[descriptor.paramID] = source.getParameters().getRawParameterValue(descriptor.id)->load();
+
+        const auto restore = [](const juce::MemoryBlock& blob) {
+            auto target = std::make_unique<ReeseDestroyerAudioProcessor>();
+
+            for (const auto& descriptor : parameterTable)
+                target->getParameters().getParameter(descriptor.id)->setValueNotifyingHost(0.73f);
+
+            target->setStateInformation(blob.getData(), static_cast<int>(blob.getSize()));
+            return target;
+        };
+
+        juce::MemoryBlock binary;
+        source.getStateInformation(binary);
+
+        const auto roundTrip = stateMismatches(*restore(binary), saved);
+        report("state binary round trip", roundTrip.isEmpty(), roundTrip.isEmpty() ? "all parameters" : roundTrip);
+
+        // A blob from before the modulation matrix: the sound rows, then table defaults
+        const auto numStored = static_cast<juce::uint32>(toIndex(ParamID::lfo1Rate));
+        juce::MemoryBlock truncated(binary.getData(), StateSerializer::headerSize + numStored * sizeof(float));
+        auto* header = static_cast<juce::uint8*>(truncated.getData());
+        header[6] = static_cast<juce::uint8>(numStored);
+        header[7] = 0;
+        const juce::uint32 blockSize = numStored * sizeof(float);
+        for (int i = 0; i < 4; ++i)
+            header[8 + i] = static_cast<juce::uint8>(blockSize >> (8 * i));
+
+        ParameterValues olderExpected;
+        for (size_t i = 0; i < numStored; ++i)
+            olderExpected.values[i] = saved.values[i];
+
+        const auto older = stateMismatches(*restore(truncated), olderExpected);
+        report("state shorter blob, the rest at table defaults", older.isEmpty(), older.isEmpty() ? juce::String(static_cast<int>(numStored)) + " stored" : older);
+
+        // v1.0 sessions: the APVTS tree as XML, here without a row it predates
+        auto xml = source.getParameters().copyState().createXml();
+        if (auto* ceiling = xml->getChildByAttribute("id", "limiterCeiling"))
+            xml->removeChildElement(ceiling, true);
+
+        juce::MemoryBlock legacy;
+        juce::AudioProcessor::copyXmlToBinary(*xml, legacy);
+
+        ParameterValues legacyExpected = saved;
+        legacyExpected[ParamID::limiterCeiling] = ParameterTable::get(ParamID::limiterCeiling).defaultValue;
+
+        const auto fromXml = stateMismatches(*restore(legacy), legacyExpected);
+        report("state legacy XML, missing rows at table defaults", fromXml.isEmpty(), fromXml.isEmpty() ? "all parameters" : fromXml);
+    }
+
+    void testBatchedEngine(const std::vector<GoldenSignal>& signals)
+    {
+        // One lane per preset, signal and channel (not a multiple of the vector width)
+        struct Lane
+        {
+            juce::String name;
+            const std::vector<float>* input;
+            std::vector<float> reference;
+            std::vector<float> output;
+        };
+
+        std::vector<Lane> lanes;
+        std::vector<BatchedReeseEngine::InstanceParameters> laneParameters;
+
+        for (const auto& preset : getBatchPresets())
+        {
+            const auto instance = getInstanceParameters(preset);
+
+            for (const auto& signal : signals)
+            {
+                const auto rendered = render(signal, preset, {});
+
+                for (int channel = 0; channel < 2; ++channel)
+                {
+                    Lane lane { juce::String(preset.name) + " " + signal.name + (channel == 0 ? " L" : " R"),
+                                channel == 0 ? &signal.left : &signal.right, {}, {} };
+
+                    for (size_t i = static_cast<size_t>(channel); i < rendered.size(); i += 2)
+                        lane.reference.push_back(rendered[i]);
+
+                    lane.output.resize(lane.reference.size());
+                    lanes.push_back(std::move(lane));
+                    laneParameters.push_back(instance);
+                }
+            }
+        }
+
+        BatchedReeseEngine engine;
+        engine.prepare(sampleRate, static_cast<int>(lanes.size()));
+
+        for (size_t i = 0; i < lanes.size(); ++i)
+            engine.setParameters(static_cast<int>(i), laneParameters[i]);
+
+        // Host-sized blocks, longer than the engine's sub-block and not a multiple of it
+        constexpr int blockSize = 500;
+        std::vector<const float*> inputs(lanes.size());
+        std::vector<float*> outputs(lanes.size());
+
+        for (int start = 0; start < numSamples; start += blockSize)
+        {
+            for (size_t i = 0; i < lanes.size(); ++i)
+            {
+                inputs[i] = lanes[i].input->data() + start;
+                outputs[i] = lanes[i].output.data() + start;
+            }
+
+            engine.process(inputs.data(), outputs.data(), juce::jmin(blockSize, numSamples - start));
+        }
+
+        for (const auto& lane : lanes)
+            expectNull("batched engine vs processor " + lane.name, lane.reference, lane.output, -100.0);
+    }
+
+    //==============================================================================
+    juce::File getGoldenFile(const juce::File& directory, const Preset& preset, const GoldenSignal& signal)
+    {
+        return directory.getChildFile(juce::String(preset.name) + "-" + signal.name + ".f32");
+    }
+
+    void recordGolden(const std::vector<GoldenSignal>& signals, const juce::File& directory)
+    {
+        directory.createDirectory();
+
+        for (const auto& preset : getPresets())
+        {
+            for (const auto& signal : signals)
+            {
+                const auto output = render(signal, preset, {});
+                const auto file = getGoldenFile(directory, preset, signal);
+
+                report("record " + file.getFileName(),
+                       file.replaceWithData(output.data(), output.size() * sizeof(float)),
+                       file.getFullPathName());
+            }
+        }
+    }
+
+    void compareGolden(const std::vector<GoldenSignal>& signals, const juce::File& directory)
+    {
+        for (const auto& preset : getPresets())
+        {
+            for (const auto& signal : signals)
+            {
+                const auto file = getGoldenFile(directory, preset, signal);
+                juce::MemoryBlock data;
+
+                if (!report("golden " + file.getFileName() + " loaded", file.loadFileAsData(data),
+                            file.getFullPathName()))
+                    continue;
+
+                const auto output = render(signal, preset, {});
+                std::vector<float> golden(data.getSize() / sizeof(float));
+                data.copyTo(golden.data(), 0, golden.size() * sizeof(float));
+
+                if (!report("golden " + file.getFileName() + " length", golden.size() == output.size(),
+                            juce::String(static_cast<int>(golden.size())) + " samples"))
+                    continue;
+
+                expectNull("golden " + file.getFileName(), golden, output, -80.0);
+            }
+        }
+    }
+}
+
+//==============================================================================
+void runProcessorTests(const juce::File& recordDirectory, const juce::File& goldenDirectory)
+{
+    const auto signals = makeGoldenSignals(sampleRate, numSamples);
+
+    if (recordDirectory != juce::File())
+    {
+        std::printf("\nRecording golden renders\n");
+        recordGolden(signals, recordDirectory);
+        return;
+    }
+
+    std::printf("\nProcessor: finite output\n");
+    testFinite(signals);
+
+    std::printf("\nProcessor: scheduling nulls (must be exact)\n");
+    testSchedulingNulls(signals);
+
+    std::printf("\nProcessor: processing profiles\n");
+    testProfiles(signals);
+
+    std::printf("\nProcessor: stereo sharing\n");
+    testStereoSharing(signals);
+
+    std::printf("\nProcessor: ladder filter model\n");
+    testLadderModel(signals);
+
+    std::printf("\nProcessor: modulation destinations\n");
+    testModulationDestinations(signals);
+
+    std::printf("\nProcessor: cabinet\n");
+    testCabinet(signals);
+
+    std::printf("\nProcessor: presets\n");
+    testPresets(signals);
+
+    std::printf("\nProcessor: parameter history\n");
+    testParameterHistory();
+
+    std::printf("\nProcessor: state\n");
+    testState();
+
+    std::printf("\nProcessor: bypass\n");
+    testBypass(signals);
+
+    std::printf("\nProcessor: limiter lookahead automation\n");
+    testLimiterAutomation(signals);
+
+    std::printf("\nProcessor: batched engine lanes\n");
+    testBatchedEngine(signals);
+
+    if (goldenDirectory != juce::File())
+    {
+        std::printf("\nProcessor: golden renders\n");
+        compareGolden(signals, goldenDirectory);
+    }
+}